@@ -0,0 +1,231 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/instrumentation.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/uri/instrumentation.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#ifdef RRLIB_URI_INSTRUMENTATION
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#endif
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+namespace instrumentation
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+#ifdef RRLIB_URI_INSTRUMENTATION
+
+namespace
+{
+
+const size_t cOPERATION_COUNT = static_cast<size_t>(tOperation::DIMENSION);
+
+/*! Counters of one thread */
+struct tThreadCounters
+{
+  /*! Counters for each operation */
+  internal::tCounters counters[cOPERATION_COUNT];
+
+  /*! Counter values at last reset (only accessed with global mutex acquired) */
+  uint64_t baseline[cOPERATION_COUNT][5];
+
+  tThreadCounters();
+  ~tThreadCounters();
+};
+
+/*! Registry of all threads' counters */
+struct tRegistry
+{
+  std::mutex mutex;
+
+  /*! Counters of all active threads */
+  std::vector<tThreadCounters*> threads;
+
+  /*! Accumulated counters of threads that have terminated (since last reset) */
+  uint64_t terminated_threads[cOPERATION_COUNT][5];
+
+  tRegistry() : terminated_threads()
+  {}
+};
+
+tRegistry& GetRegistry()
+{
+  static tRegistry registry;
+  return registry;
+}
+
+tThreadCounters::tThreadCounters()
+{
+  for (size_t i = 0; i < cOPERATION_COUNT; i++)
+  {
+    for (size_t j = 0; j < 5; j++)
+    {
+      counters[i].values[j].store(0, std::memory_order_relaxed);
+      baseline[i][j] = 0;
+    }
+  }
+  tRegistry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.threads.push_back(this);
+}
+
+tThreadCounters::~tThreadCounters()
+{
+  tRegistry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), this));
+  for (size_t i = 0; i < cOPERATION_COUNT; i++)
+  {
+    for (size_t j = 0; j < 5; j++)
+    {
+      registry.terminated_threads[i][j] += counters[i].values[j].load(std::memory_order_relaxed) - baseline[i][j];
+    }
+  }
+}
+
+}
+
+#endif
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+static const char* cOPERATION_NAMES[] = { "parse", "encode", "decode", "path_set", "path_append", "serialize", "deserialize" };
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+bool Enabled()
+{
+#ifdef RRLIB_URI_INSTRUMENTATION
+  return true;
+#else
+  return false;
+#endif
+}
+
+const char* GetName(tOperation operation)
+{
+  return operation < tOperation::DIMENSION ? cOPERATION_NAMES[static_cast<size_t>(operation)] : "";
+}
+
+tStatistics GetStatistics()
+{
+  tStatistics result;
+#ifdef RRLIB_URI_INSTRUMENTATION
+  tRegistry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (size_t i = 0; i < cOPERATION_COUNT; i++)
+  {
+    uint64_t values[5];
+    for (size_t j = 0; j < 5; j++)
+    {
+      values[j] = registry.terminated_threads[i][j];
+      for (tThreadCounters * thread : registry.threads)
+      {
+        values[j] += thread->counters[i].values[j].load(std::memory_order_relaxed) - thread->baseline[i][j];
+      }
+    }
+    tOperationStatistics& statistics = result.operations[i];
+    statistics.calls = values[0];
+    statistics.errors = values[1];
+    statistics.bytes = values[2];
+    statistics.allocations = values[3];
+    statistics.nanoseconds = values[4];
+  }
+#endif
+  return result;
+}
+
+#ifdef RRLIB_URI_INSTRUMENTATION
+internal::tCounters& internal::GetThreadCounters(tOperation operation)
+{
+  static thread_local tThreadCounters thread_counters;
+  return thread_counters.counters[static_cast<size_t>(operation)];
+}
+
+internal::tCounters*& internal::GetTopLevelCounters()
+{
+  static thread_local tCounters* top_level_counters = nullptr;
+  return top_level_counters;
+}
+#endif
+
+void ResetStatistics()
+{
+#ifdef RRLIB_URI_INSTRUMENTATION
+  // Counters are only written by their threads - so reset is implemented by storing the current values as baseline
+  tRegistry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (size_t i = 0; i < cOPERATION_COUNT; i++)
+  {
+    for (size_t j = 0; j < 5; j++)
+    {
+      registry.terminated_threads[i][j] = 0;
+      for (tThreadCounters * thread : registry.threads)
+      {
+        thread->baseline[i][j] = thread->counters[i].values[j].load(std::memory_order_relaxed);
+      }
+    }
+  }
+#endif
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
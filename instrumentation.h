@@ -0,0 +1,251 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/instrumentation.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Optional instrumentation of hot paths in the uri library
+ *
+ * Counts calls, processed bytes, errors, allocations and time spent in
+ * tURI::Parse, Encode, Decode, tPath::Set, Append and (de)serialization.
+ *
+ * Instrumentation is compiled out by default. It is enabled by defining
+ * RRLIB_URI_INSTRUMENTATION when compiling the library (e.g. -DRRLIB_URI_INSTRUMENTATION).
+ * Otherwise, the API below is still available - and returns empty statistics.
+ *
+ * Counters are kept per thread (so that instrumented calls do not contend)
+ * and are merged when statistics are obtained.
+ *
+ * Only top-level calls are counted: operations performed by another instrumented
+ * operation (e.g. Decode and tPath::Set inside Parse) are not counted separately -
+ * their allocations are added to the top-level operation instead.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__instrumentation_h__
+#define __rrlib__uri__instrumentation_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdint>
+#include <cstddef>
+#ifdef RRLIB_URI_INSTRUMENTATION
+#include <atomic>
+#include <chrono>
+#include <exception>
+#endif
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+namespace instrumentation
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Instrumented operations */
+enum class tOperation
+{
+  PARSE,         //!< tURI::Parse
+  ENCODE,        //!< tURI::Encode
+  DECODE,        //!< tURI::Decode
+  PATH_SET,      //!< tPath::Set (from string)
+  PATH_APPEND,   //!< tPath::Append
+  SERIALIZE,     //!< Serialization of tPath and tURI
+  DESERIALIZE,   //!< Deserialization of tPath and tURI
+  DIMENSION
+};
+
+/*! Statistics on one operation */
+struct tOperationStatistics
+{
+  uint64_t calls = 0;        //!< Number of calls
+  uint64_t errors = 0;       //!< Number of calls that threw an exception
+  uint64_t bytes = 0;        //!< Number of input bytes processed
+  uint64_t allocations = 0;  //!< Number of heap allocations performed by the library
+  uint64_t nanoseconds = 0;  //!< Total time spent in operation
+};
+
+/*! Statistics on all operations */
+struct tStatistics
+{
+  tOperationStatistics operations[static_cast<size_t>(tOperation::DIMENSION)];
+
+  const tOperationStatistics& operator[](tOperation operation) const
+  {
+    return operations[static_cast<size_t>(operation)];
+  }
+};
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * \return Whether instrumentation was compiled into library
+ */
+bool Enabled();
+
+/*!
+ * \return Name of operation (e.g. for metrics export)
+ */
+const char* GetName(tOperation operation);
+
+/*!
+ * Obtains statistics - merged from the counters of all threads (since last reset)
+ *
+ * Calls, errors, bytes and time are exact for top-level calls.
+ * Allocations are estimates: they are derived from capacity checks before containers are resized -
+ * so allocations performed by the standard library itself (e.g. growth beyond the requested size) are not included.
+ *
+ * \return Statistics
+ */
+tStatistics GetStatistics();
+
+/*!
+ * Resets statistics of all threads
+ */
+void ResetStatistics();
+
+// The macros below depend on how the library was compiled. They must therefore only be
+// used in the library's translation units - never in inline code of public headers.
+#ifdef RRLIB_URI_INSTRUMENTATION
+
+namespace internal
+{
+
+/*! Counters of one operation in one thread (only written by that thread) */
+struct tCounters
+{
+  std::atomic<uint64_t> values[5];  // calls, errors, bytes, allocations, nanoseconds
+};
+
+/*!
+ * \return Counters of the current thread for the specified operation
+ */
+tCounters& GetThreadCounters(tOperation operation);
+
+/*!
+ * \return Counters of the current thread's top-level operation (nullptr if no instrumented operation is active)
+ */
+tCounters*& GetTopLevelCounters();
+
+/*!
+ * Instruments one call of an operation (from construction until destruction).
+ * Calls are counted as errors if they are left with an exception.
+ * Nested calls are not counted - allocations are added to the top-level operation.
+ */
+class tScope
+{
+public:
+
+  tScope(tOperation operation, size_t bytes) :
+    top_level_counters(GetTopLevelCounters()),
+    nested(top_level_counters != nullptr),
+    counters(nested ? *top_level_counters : GetThreadCounters(operation)),
+#if __cplusplus >= 201703L
+    uncaught_exceptions(std::uncaught_exceptions()),
+#endif
+    start(nested ? std::chrono::steady_clock::time_point() : std::chrono::steady_clock::now())
+  {
+    if (!nested)
+    {
+      top_level_counters = &counters;
+      Add(0, 1);
+      Add(2, bytes);
+    }
+  }
+
+  ~tScope()
+  {
+    if (nested)
+    {
+      return;
+    }
+    top_level_counters = nullptr;
+#if __cplusplus >= 201703L
+    if (std::uncaught_exceptions() > uncaught_exceptions)
+#else
+    if (std::uncaught_exception())
+#endif
+    {
+      Add(1, 1);
+    }
+    Add(4, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+  }
+
+  void AddAllocations(uint64_t allocations)
+  {
+    Add(3, allocations);
+  }
+
+private:
+
+  tCounters*& top_level_counters;
+  const bool nested;
+  tCounters& counters;
+#if __cplusplus >= 201703L
+  int uncaught_exceptions;
+#endif
+  std::chrono::steady_clock::time_point start;
+
+  void Add(size_t index, uint64_t value)
+  {
+    // Counters are only written by the current thread - so no (expensive) atomic read-modify-write operation is required
+    counters.values[index].store(counters.values[index].load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+  }
+};
+
+}
+
+#define RRLIB_URI_INSTRUMENT(operation, bytes) rrlib::uri::instrumentation::internal::tScope rrlib_uri_instrumentation_scope(rrlib::uri::instrumentation::tOperation::operation, bytes)
+#define RRLIB_URI_INSTRUMENT_ALLOCATIONS(count) rrlib_uri_instrumentation_scope.AddAllocations(count)
+
+#else
+
+#define RRLIB_URI_INSTRUMENT(operation, bytes) ((void)0)
+#define RRLIB_URI_INSTRUMENT_ALLOCATIONS(count) ((void)0)
+
+#endif
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
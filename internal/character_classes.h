@@ -0,0 +1,281 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/internal/character_classes.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Character classes of RFC 3986
+ *
+ * Table-driven character classification shared by the URI implementation.
+ * Contains (SSE2/SSSE3-accelerated) scans for runs of ASCII characters and characters in a class.
+ * If the library is compiled without SSSE3 support (as by default on x86-64), the SSSE3 scan is selected at runtime
+ * on CPUs that support it (GCC and clang).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__internal__character_classes_h__
+#define __rrlib__uri__internal__character_classes_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#if defined(__SSSE3__) || (defined(__SSE2__) && defined(__GNUC__))
+#include <tmmintrin.h>
+#endif
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+// Functions with SSSE3 instructions are marked with RRLIB_URI_SSSE3_FUNCTION.
+// RRLIB_URI_SSSE3_RUNTIME_DISPATCH is defined if they may only be called after checking CPU support.
+#if defined(__SSSE3__)
+#define RRLIB_URI_SSSE3_FUNCTION
+#elif defined(__SSE2__) && defined(__GNUC__)
+#define RRLIB_URI_SSSE3_FUNCTION __attribute__((target("ssse3")))
+#define RRLIB_URI_SSSE3_RUNTIME_DISPATCH
+#endif
+
+/*!
+ * Character classes (bits in cCHARACTER_CLASSES).
+ * Percent-encodings are not covered by the classes - '%' needs to be handled separately.
+ */
+enum tCharacterClass : uint8_t
+{
+  cUNRESERVED = 1 << 0,  //!< ALPHA / DIGIT / "-" / "." / "_" / "~"
+  cPATH = 1 << 1,        //!< pchar / "/"  (pchar = unreserved / sub-delims / ":" / "@")
+  cQUERY = 1 << 2,       //!< pchar / "/" / "?"  (query and fragment)
+  cUSER_INFO = 1 << 3,   //!< unreserved / sub-delims / ":"
+  cREG_NAME = 1 << 4,    //!< unreserved / sub-delims
+  cSCHEME = 1 << 5,      //!< ALPHA / DIGIT / "+" / "-" / "."
+  cDIGIT = 1 << 6,       //!< DIGIT
+  cHEX_DIGIT = 1 << 7    //!< HEXDIG (case-insensitive)
+};
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Classes of all 256 characters (generated from the sets above) */
+static const uint8_t cCHARACTER_CLASSES[256] =
+{
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x00
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x10
+  0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x3E, 0x1E, 0x3F, 0x3F, 0x06,  // 0x20
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x1E, 0x00, 0x1E, 0x00, 0x04,  // 0x30
+  0x06, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,  // 0x40
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F,  // 0x50
+  0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,  // 0x60
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x00,  // 0x70
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x80
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x90
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xA0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xB0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xC0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xD0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xE0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00  // 0xF0
+};
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * \return Whether character belongs to character class
+ */
+static inline bool IsInClass(char c, tCharacterClass character_class)
+{
+  return cCHARACTER_CLASSES[static_cast<unsigned char>(c)] & character_class;
+}
+
+/*!
+ * \return Whether character is an unreserved character (RFC 3986, section 2.3)
+ */
+static inline bool IsUnreserved(char c)
+{
+  return IsInClass(c, cUNRESERVED);
+}
+
+/*!
+ * \return Value of hexadecimal digit - or -1 if character is no hexadecimal digit
+ */
+static inline int HexValue(char c)
+{
+  return (c >= '0' && c <= '9') ? (c - '0') : ((c >= 'A' && c <= 'F') ? (c - 'A' + 10) : ((c >= 'a' && c <= 'f') ? (c - 'a' + 10) : -1));
+}
+
+#ifdef RRLIB_URI_SSSE3_FUNCTION
+/*!
+ * Lookup tables for classifying 16 characters at once with pshufb:
+ * a character c (< 0x80) is in the class if (low_nibbles[c & 0xF] & high_nibbles[c >> 4]) != 0.
+ * Each high nibble 0-7 gets its own bit - so this classification is exact. Characters >= 0x80 are in no class.
+ */
+struct tNibbleTables
+{
+  __m128i low_nibbles, high_nibbles;
+
+  explicit tNibbleTables(tCharacterClass character_class)
+  {
+    alignas(16) uint8_t low[16] = {}, high[16] = {};
+    for (int c = 0; c < 0x80; c++)
+    {
+      if (cCHARACTER_CLASSES[c] & character_class)
+      {
+        low[c & 0xF] |= 1 << (c >> 4);
+      }
+    }
+    for (int i = 0; i < 8; i++)
+    {
+      high[i] = 1 << i;
+    }
+    low_nibbles = _mm_load_si128(reinterpret_cast<const __m128i*>(low));
+    high_nibbles = _mm_load_si128(reinterpret_cast<const __m128i*>(high));
+  }
+};
+
+/*!
+ * SSSE3 part of CountLeadingCharacters(): scans blocks of 16 characters
+ *
+ * \return Number of characters at the beginning of string that belong to the character class - or number of scanned characters if no block contains other characters
+ */
+RRLIB_URI_SSSE3_FUNCTION static inline size_t CountLeadingCharactersSSSE3(const char* string, size_t length, tCharacterClass character_class)
+{
+  static const tNibbleTables cTABLES[8] =
+  {
+    tNibbleTables(cUNRESERVED), tNibbleTables(cPATH), tNibbleTables(cQUERY), tNibbleTables(cUSER_INFO),
+    tNibbleTables(cREG_NAME), tNibbleTables(cSCHEME), tNibbleTables(cDIGIT), tNibbleTables(cHEX_DIGIT)
+  };
+  const tNibbleTables& tables = cTABLES[__builtin_ctz(character_class)];
+  const __m128i low_mask = _mm_set1_epi8(0x0F);
+  size_t count = 0;
+  for (; count + 16 <= length; count += 16)
+  {
+    __m128i characters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(string + count));
+    __m128i low_bits = _mm_shuffle_epi8(tables.low_nibbles, _mm_and_si128(characters, low_mask));
+    __m128i high_bits = _mm_shuffle_epi8(tables.high_nibbles, _mm_and_si128(_mm_srli_epi16(characters, 4), low_mask));
+    int mismatches = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(low_bits, high_bits), _mm_setzero_si128()));
+    if (mismatches)
+    {
+      return count + __builtin_ctz(mismatches);
+    }
+  }
+  return count;
+}
+#endif
+
+#ifdef RRLIB_URI_SSSE3_RUNTIME_DISPATCH
+/*!
+ * \return Whether CPU supports SSSE3 instructions (checked once)
+ */
+static inline bool CPUSupportsSSSE3()
+{
+  static const bool cSUPPORTED = (__builtin_cpu_init(), __builtin_cpu_supports("ssse3"));
+  return cSUPPORTED;
+}
+#endif
+
+/*!
+ * \param string String to scan
+ * \param length Length of string
+ * \param character_class Character class (exactly one bit)
+ * \return Number of characters at the beginning of string that belong to the character class
+ */
+static inline size_t CountLeadingCharacters(const char* string, size_t length, tCharacterClass character_class)
+{
+  size_t count = 0;
+#if defined(RRLIB_URI_SSSE3_RUNTIME_DISPATCH)
+  if (length >= 16 && CPUSupportsSSSE3())
+  {
+    count = CountLeadingCharactersSSSE3(string, length, character_class);
+  }
+#elif defined(RRLIB_URI_SSSE3_FUNCTION)
+  if (length >= 16)
+  {
+    count = CountLeadingCharactersSSSE3(string, length, character_class);
+  }
+#endif
+  while (count < length && IsInClass(string[count], character_class))
+  {
+    count++;
+  }
+  return count;
+}
+
+/*!
+ * \param string String to scan
+ * \param length Length of string
+ * \param stop_character ASCII character that also ends the run (e.g. '%' - or 0 for none)
+ * \return Number of ASCII characters at the beginning of string (before the first non-ASCII or stop character)
+ */
+static inline size_t CountLeadingASCII(const char* string, size_t length, char stop_character)
+{
+  size_t count = 0;
+#ifdef __SSE2__
+  const __m128i stop_characters = _mm_set1_epi8(stop_character);
+  for (; count + 16 <= length; count += 16)
+  {
+    __m128i characters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(string + count));
+    int stops = _mm_movemask_epi8(characters) | (stop_character ? _mm_movemask_epi8(_mm_cmpeq_epi8(characters, stop_characters)) : 0);
+    if (stops)
+    {
+      return count + __builtin_ctz(stops);
+    }
+  }
+#endif
+  while (count < length && (string[count] & 0x80) == 0 && (string[count] != stop_character || stop_character == 0))
+  {
+    count++;
+  }
+  return count;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,291 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tAuthority.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/uri/tAuthority.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/internal/character_classes.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::uri::internal;
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+bool tAuthority::ParseIPv4Address(const tStringRange& address_string, uint8_t* address)
+{
+  const char* current = address_string.CharPointer();
+  const char* end = current + address_string.Length();
+  for (int i = 0; i < 4; i++)
+  {
+    if (i > 0)
+    {
+      if (current == end || (*current) != '.')
+      {
+        return false;
+      }
+      current++;
+    }
+
+    // dec-octet: 1-3 digits without leading zeros, <= 255
+    const char* octet_begin = current;
+    uint value = 0;
+    while (current != end && (*current) >= '0' && (*current) <= '9' && current - octet_begin < 3)
+    {
+      value = value * 10 + static_cast<uint>((*current) - '0');
+      current++;
+    }
+    size_t digits = current - octet_begin;
+    if (digits == 0 || value > 255 || (digits > 1 && (*octet_begin) == '0'))
+    {
+      return false;
+    }
+    address[i] = static_cast<uint8_t>(value);
+  }
+  return current == end;
+}
+
+bool tAuthority::ParseIPv6Address(const tStringRange& address_string, uint8_t* address)
+{
+  const char* current = address_string.CharPointer();
+  const char* end = current + address_string.Length();
+  int compression_index = -1; // index of group where '::' is located
+  int group_count = 0;
+
+  if (end - current >= 2 && current[0] == ':' && current[1] == ':')
+  {
+    compression_index = 0;
+    current += 2;
+  }
+  while (current != end)
+  {
+    if (group_count == 8)
+    {
+      return false;
+    }
+
+    // Parse up to 4 hexadecimal digits
+    const char* group_begin = current;
+    uint value = 0;
+    int digit = 0;
+    while (current != end && current - group_begin < 4 && (digit = HexValue(*current)) >= 0)
+    {
+      value = (value << 4) | static_cast<uint>(digit);
+      current++;
+    }
+
+    // Embedded IPv4 address in last 32 bits?
+    if (current != end && (*current) == '.')
+    {
+      if (group_count > 6 || !ParseIPv4Address(tStringRange(group_begin, end - group_begin), &address[group_count * 2]))
+      {
+        return false;
+      }
+      group_count += 2;
+      current = end;
+      break;
+    }
+    if (current == group_begin)
+    {
+      return false;
+    }
+    address[group_count * 2] = static_cast<uint8_t>(value >> 8);
+    address[group_count * 2 + 1] = static_cast<uint8_t>(value & 0xFF);
+    group_count++;
+
+    if (current == end)
+    {
+      break;
+    }
+    if ((*current) != ':')
+    {
+      return false;
+    }
+    current++;
+    if (current != end && (*current) == ':')
+    {
+      if (compression_index >= 0)
+      {
+        return false;
+      }
+      compression_index = group_count;
+      current++;
+    }
+    else if (current == end)
+    {
+      return false; // trailing single ':'
+    }
+  }
+
+  // Expand '::'
+  if (compression_index >= 0)
+  {
+    if (group_count == 8)
+    {
+      return false;
+    }
+    int move_groups = group_count - compression_index;
+    memmove(&address[(8 - move_groups) * 2], &address[compression_index * 2], move_groups * 2);
+    memset(&address[compression_index * 2], 0, (8 - group_count) * 2);
+    return true;
+  }
+  return group_count == 8;
+}
+
+bool tAuthority::ParsePort(const tStringRange& port_string, uint16_t& port)
+{
+  if (port_string.Length() == 0)
+  {
+    return false;
+  }
+  uint value = 0;
+  for (size_t i = 0; i < port_string.Length(); i++)
+  {
+    char c = port_string.CharPointer()[i];
+    if (c < '0' || c > '9')
+    {
+      return false;
+    }
+    value = value * 10 + static_cast<uint>(c - '0');
+    if (value > 0xFFFF)
+    {
+      return false;
+    }
+  }
+  port = static_cast<uint16_t>(value);
+  return true;
+}
+
+void tAuthority::Set(const tStringRange& authority)
+{
+  const char* begin = authority.CharPointer();
+  const char* end = begin + authority.Length();
+
+  // User information (up to last '@' - as '@' is not allowed in host and port)
+  const char* host_begin = begin;
+  has_user_info = false;
+  for (const char* current = end; current != begin; current--)
+  {
+    if (current[-1] == '@')
+    {
+      has_user_info = true;
+      host_begin = current;
+      break;
+    }
+  }
+  user_info = tStringRange(begin, has_user_info ? (host_begin - begin - 1) : 0);
+
+  // Host
+  const char* host_end = nullptr;
+  if (host_begin != end && (*host_begin) == '[')
+  {
+    const char* closing_bracket = static_cast<const char*>(memchr(host_begin, ']', end - host_begin));
+    if (!closing_bracket)
+    {
+      throw std::invalid_argument("Malformed IP literal in URI authority (missing ']')");
+    }
+    host = tStringRange(host_begin + 1, closing_bracket - host_begin - 1);
+    host_end = closing_bracket + 1;
+    if (host.Length() && (host.CharPointer()[0] == 'v' || host.CharPointer()[0] == 'V'))
+    {
+      host_type = tHostType::IP_FUTURE;
+    }
+    else if (ParseIPv6Address(host, ip_address))
+    {
+      host_type = tHostType::IPV6_ADDRESS;
+    }
+    else
+    {
+      throw std::invalid_argument("Malformed IPv6 address in URI authority");
+    }
+    if (host_end != end && (*host_end) != ':')
+    {
+      throw std::invalid_argument("Malformed URI authority (unexpected characters after IP literal)");
+    }
+  }
+  else
+  {
+    host_end = end;
+    for (const char* current = host_begin; current != end; current++)
+    {
+      if ((*current) == ':')
+      {
+        host_end = current;
+        break;
+      }
+    }
+    host = tStringRange(host_begin, host_end - host_begin);
+    host_type = ParseIPv4Address(host, ip_address) ? tHostType::IPV4_ADDRESS : tHostType::REGISTERED_NAME;
+  }
+
+  // Port (may be empty after ':')
+  port_string = tStringRange(host_end == end ? end : host_end + 1, host_end == end ? 0 : end - host_end - 1);
+  port = 0;
+  if (port_string.Length() && (!ParsePort(port_string, port)))
+  {
+    throw std::invalid_argument("Invalid port in URI authority");
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
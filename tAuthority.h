@@ -0,0 +1,240 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tAuthority.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tAuthority
+ *
+ * \b tAuthority
+ *
+ * View on the (percent-encoded) authority of a URI - split into user information, host and port.
+ * Like tStringRange, it references the original string - and is only valid as long as this string is not modified.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__tAuthority_h__
+#define __rrlib__uri__tAuthority_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdint>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tURIElements.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! URI authority
+/*!
+ * View on the (percent-encoded) authority of a URI - split into user information, host and port
+ * (authority = [ userinfo "@" ] host [ ":" port ] - see RFC 3986, section 3.2).
+ * Splitting does not allocate any memory.
+ * IP literal hosts are additionally parsed to binary addresses.
+ *
+ * Like tStringRange, it references the original string - and is only valid as long as this string is not modified.
+ */
+class tAuthority
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Type of host in authority */
+  enum class tHostType
+  {
+    REGISTERED_NAME,  //!< Registered name (e.g. host name - possibly empty)
+    IPV4_ADDRESS,     //!< IPv4 address in dotted-decimal form
+    IPV6_ADDRESS,     //!< IPv6 address in brackets
+    IP_FUTURE         //!< IPvFuture literal in brackets (address is not parsed)
+  };
+
+  /*! Creates empty authority */
+  tAuthority() :
+    user_info(),
+    host(),
+    port_string(),
+    host_type(tHostType::REGISTERED_NAME),
+    has_user_info(false),
+    port(0),
+    ip_address()
+  {}
+
+  /*!
+   * \param authority Percent-encoded authority (e.g. tURIElements::authority)
+   * \throws std::invalid_argument if authority is malformed (invalid port or IP literal)
+   */
+  tAuthority(const tStringRange& authority) :
+    tAuthority()
+  {
+    Set(authority);
+  }
+
+  /*!
+   * \return Host (percent-encoded; IP literals without brackets)
+   */
+  const tStringRange& GetHost() const
+  {
+    return host;
+  }
+
+  /*!
+   * \return Type of host
+   */
+  tHostType GetHostType() const
+  {
+    return host_type;
+  }
+
+  /*!
+   * \return Binary IP address in network byte order (4 bytes for IPv4 addresses, 16 bytes for IPv6 addresses; only valid if host is one of these)
+   */
+  const uint8_t* GetIPAddress() const
+  {
+    return ip_address;
+  }
+
+  /*!
+   * \param default_port Port to return if authority contains no port (typically depends on scheme)
+   * \return Port
+   */
+  uint16_t GetPort(uint16_t default_port = 0) const
+  {
+    return HasPort() ? port : default_port;
+  }
+
+  /*!
+   * \return Port as specified in authority (empty if authority contains no port)
+   */
+  const tStringRange& GetPortString() const
+  {
+    return port_string;
+  }
+
+  /*!
+   * \return User information (percent-encoded; empty if authority contains no user information)
+   */
+  const tStringRange& GetUserInfo() const
+  {
+    return user_info;
+  }
+
+  /*!
+   * \return Whether authority contains a (non-empty) port
+   */
+  bool HasPort() const
+  {
+    return port_string.Length() > 0;
+  }
+
+  /*!
+   * \return Whether authority contains user information (possibly empty - as in "@host")
+   */
+  bool HasUserInfo() const
+  {
+    return has_user_info;
+  }
+
+  /*!
+   * Parses IPv4 address in dotted-decimal form (e.g. 192.168.0.1)
+   *
+   * \param address_string Address string
+   * \param address Buffer to write binary address to (4 bytes, network byte order)
+   * \return Whether address_string is a valid IPv4 address (otherwise, contents of address are undefined)
+   */
+  static bool ParseIPv4Address(const tStringRange& address_string, uint8_t* address);
+
+  /*!
+   * Parses IPv6 address (without brackets - e.g. fe80::1 or ::ffff:192.168.0.1)
+   *
+   * \param address_string Address string
+   * \param address Buffer to write binary address to (16 bytes, network byte order)
+   * \return Whether address_string is a valid IPv6 address (otherwise, contents of address are undefined)
+   */
+  static bool ParseIPv6Address(const tStringRange& address_string, uint8_t* address);
+
+  /*!
+   * Parses port
+   *
+   * \param port_string Port string (decimal digits)
+   * \param port Variable to write port to
+   * \return Whether port_string is a valid port in range 0-65535
+   */
+  static bool ParsePort(const tStringRange& port_string, uint16_t& port);
+
+  /*!
+   * Splits authority
+   *
+   * \param authority Percent-encoded authority (e.g. tURIElements::authority)
+   * \throws std::invalid_argument if authority is malformed (invalid port or IP literal)
+   */
+  void Set(const tStringRange& authority);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Components of authority */
+  tStringRange user_info, host, port_string;
+
+  /*! Type of host */
+  tHostType host_type;
+
+  /*! Whether authority contains user information */
+  bool has_user_info;
+
+  /*! Parsed port (valid if port_string is not empty) */
+  uint16_t port;
+
+  /*! Binary IP address (if host is an IP address) */
+  uint8_t ip_address[16];
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,370 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tIRI.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/uri/tIRI.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/internal/character_classes.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::uri::internal;
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*!
+ * Incremental UTF-8 validator (RFC 3629): bytes are passed one at a time.
+ * Rejects overlong encodings, surrogates, and code points above U+10FFFF.
+ */
+struct tUTF8Validator
+{
+  uint8_t remaining;  //!< Number of continuation bytes still expected
+  uint8_t lower;      //!< Lower bound of next continuation byte
+  uint8_t upper;      //!< Upper bound of next continuation byte
+
+  tUTF8Validator() : remaining(0), lower(0x80), upper(0xBF)
+  {}
+
+  /*!
+   * \return Whether byte is valid at this position
+   */
+  bool Put(uint8_t byte)
+  {
+    if (remaining)
+    {
+      if (byte < lower || byte > upper)
+      {
+        return false;
+      }
+      remaining--;
+      lower = 0x80;
+      upper = 0xBF;
+      return true;
+    }
+    if (byte < 0x80)
+    {
+      return true;
+    }
+    if (byte >= 0xC2 && byte <= 0xDF)
+    {
+      remaining = 1;
+    }
+    else if (byte >= 0xE0 && byte <= 0xEF)
+    {
+      remaining = 2;
+      lower = byte == 0xE0 ? 0xA0 : 0x80;
+      upper = byte == 0xED ? 0x9F : 0xBF;
+    }
+    else if (byte >= 0xF0 && byte <= 0xF4)
+    {
+      remaining = 3;
+      lower = byte == 0xF0 ? 0x90 : 0x80;
+      upper = byte == 0xF4 ? 0x8F : 0xBF;
+    }
+    else
+    {
+      return false;
+    }
+    return true;
+  }
+
+  /*!
+   * \return Whether no character is incomplete
+   */
+  bool Complete() const
+  {
+    return remaining == 0;
+  }
+};
+
+}
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+static const char cTO_HEX_TABLE[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * \return Decoded byte if there is a valid percent-encoding at position - otherwise -1
+ */
+static inline int DecodePercentEncoding(const char* position, const char* end)
+{
+  if (end - position < 3 || position[0] != '%')
+  {
+    return -1;
+  }
+  int high = HexValue(position[1]), low = HexValue(position[2]);
+  return (high >= 0 && low >= 0) ? ((high << 4) | low) : -1;
+}
+
+/*!
+ * \return Code point of complete and valid UTF-8 sequence
+ */
+static inline uint32_t DecodeUTF8(const uint8_t* bytes, size_t count)
+{
+  static const uint8_t cLEAD_MASK[5] = { 0, 0x7F, 0x1F, 0x0F, 0x07 };
+  uint32_t code_point = bytes[0] & cLEAD_MASK[count];
+  for (size_t i = 1; i < count; i++)
+  {
+    code_point = (code_point << 6) | (bytes[i] & 0x3F);
+  }
+  return code_point;
+}
+
+/*!
+ * \return Whether character may occur unencoded in IRIs (RFC 3987, section 2.2: ucschar - or iprivate in query).
+ * Bidirectional formatting characters are excluded (RFC 3987, section 4.1).
+ */
+static inline bool IsIRICharacter(uint32_t code_point, bool query)
+{
+  if ((code_point >= 0xE000 && code_point <= 0xF8FF) || code_point >= 0xF0000)
+  {
+    return query && (code_point & 0xFFFF) <= 0xFFFD;  // iprivate
+  }
+  bool bidi_formatting = code_point == 0x200E || code_point == 0x200F || (code_point >= 0x202A && code_point <= 0x202E) || (code_point >= 0x2066 && code_point <= 0x2069);
+  return (code_point >= 0xA0 && code_point <= 0xD7FF && (!bidi_formatting)) || (code_point >= 0xF900 && code_point <= 0xFDCF) || (code_point >= 0xFDF0 && code_point <= 0xFFEF) ||
+         (code_point >= 0x10000 && code_point < 0xE0000 && (code_point & 0xFFFF) <= 0xFFFD) || (code_point >= 0xE1000 && code_point <= 0xEFFFD);
+}
+
+tIRI::tIRI(const tURI& uri) :
+  iri(uri.ToString().length(), 0)
+{
+  if (iri.length())
+  {
+    iri.resize(URIToIRI(&iri[0], uri.ToString()) - &iri[0]);
+  }
+}
+
+char* tIRI::Decode(char* decode_buffer, const tStringRange& encoded_string)
+{
+  const char* current = encoded_string.CharPointer();
+  const char* end = current + encoded_string.Length();
+  tUTF8Validator validator;
+  while (current != end)
+  {
+    size_t ascii = validator.Complete() ? CountLeadingASCII(current, end - current, '%') : 0;
+    memcpy(decode_buffer, current, ascii);
+    decode_buffer += ascii;
+    current += ascii;
+    if (current == end)
+    {
+      break;
+    }
+
+    uint8_t byte = static_cast<uint8_t>(*current);
+    if (byte == '%')
+    {
+      int decoded = DecodePercentEncoding(current, end);
+      if (decoded < 0)
+      {
+        throw std::invalid_argument("encoded IRI string cannot be decoded (invalid percent-encoding)");
+      }
+      byte = static_cast<uint8_t>(decoded);
+      current += 3;
+    }
+    else
+    {
+      current++;
+    }
+    if (!validator.Put(byte))
+    {
+      throw std::invalid_argument("decoded IRI string is no valid UTF-8");
+    }
+    (*decode_buffer++) = static_cast<char>(byte);
+  }
+  if (!validator.Complete())
+  {
+    throw std::invalid_argument("decoded IRI string is no valid UTF-8");
+  }
+  return decode_buffer;
+}
+
+char* tIRI::IRIToURI(char* buffer, const tStringRange& iri)
+{
+  const char* current = iri.CharPointer();
+  const char* end = current + iri.Length();
+  tUTF8Validator validator;
+  while (current != end)
+  {
+    size_t ascii = validator.Complete() ? CountLeadingASCII(current, end - current, 0) : 0;
+    memcpy(buffer, current, ascii);
+    buffer += ascii;
+    current += ascii;
+    if (current == end)
+    {
+      break;
+    }
+
+    uint8_t byte = static_cast<uint8_t>(*(current++));
+    if (!validator.Put(byte))
+    {
+      throw std::invalid_argument("IRI string is no valid UTF-8");
+    }
+    if (byte < 0x80)
+    {
+      (*buffer++) = static_cast<char>(byte);
+    }
+    else
+    {
+      buffer[0] = '%';
+      buffer[1] = cTO_HEX_TABLE[byte >> 4];
+      buffer[2] = cTO_HEX_TABLE[byte & 0xF];
+      buffer += 3;
+    }
+  }
+  if (!validator.Complete())
+  {
+    throw std::invalid_argument("IRI string is no valid UTF-8");
+  }
+  return buffer;
+}
+
+bool tIRI::IsValidUTF8(const tStringRange& string)
+{
+  const char* current = string.CharPointer();
+  const char* end = current + string.Length();
+  tUTF8Validator validator;
+  while (current != end)
+  {
+    current += validator.Complete() ? CountLeadingASCII(current, end - current, 0) : 0;
+    if (current != end && !validator.Put(static_cast<uint8_t>(*(current++))))
+    {
+      return false;
+    }
+  }
+  return validator.Complete();
+}
+
+tURI tIRI::ToURI() const
+{
+  std::string uri(URILength(iri), 0);
+  if (uri.length())
+  {
+    IRIToURI(&uri[0], iri);
+  }
+  return tURI(std::move(uri));
+}
+
+size_t tIRI::URILength(const tStringRange& iri)
+{
+  size_t length = iri.Length();
+  const char* current = iri.CharPointer();
+  const char* end = current + iri.Length();
+  while (current != end)
+  {
+    current += CountLeadingASCII(current, end - current, 0);
+    for (; current != end && ((*current) & 0x80); current++)
+    {
+      length += 2;
+    }
+  }
+  return length;
+}
+
+char* tIRI::URIToIRI(char* buffer, const tStringRange& uri)
+{
+  const char* current = uri.CharPointer();
+  const char* end = current + uri.Length();
+  const char* fragment = static_cast<const char*>(memchr(current, '#', end - current));
+  const char* query = static_cast<const char*>(memchr(current, '?', (fragment ? fragment : end) - current));
+  const char* query_end = query ? (fragment ? fragment : end) : nullptr;
+  while (current != end)
+  {
+    size_t ascii = CountLeadingASCII(current, end - current, '%');
+    memcpy(buffer, current, ascii);
+    buffer += ascii;
+    current += ascii;
+    if (current == end)
+    {
+      break;
+    }
+
+    // Decode percent-encoded UTF-8 sequence if it is complete and valid - and encodes a character allowed in IRIs
+    int lead = DecodePercentEncoding(current, end);
+    tUTF8Validator validator;
+    if (lead >= 0x80 && validator.Put(static_cast<uint8_t>(lead)))
+    {
+      uint8_t bytes[4] = { static_cast<uint8_t>(lead) };
+      size_t count = 1;
+      int next;
+      while ((!validator.Complete()) && (next = DecodePercentEncoding(current + 3 * count, end)) >= 0 && validator.Put(static_cast<uint8_t>(next)))
+      {
+        bytes[count++] = static_cast<uint8_t>(next);
+      }
+      if (validator.Complete() && IsIRICharacter(DecodeUTF8(bytes, count), query && current > query && current < query_end))
+      {
+        memcpy(buffer, bytes, count);
+        buffer += count;
+        current += 3 * count;
+        continue;
+      }
+    }
+    size_t copy = lead >= 0 ? 3 : 1;
+    memcpy(buffer, current, copy);
+    buffer += copy;
+    current += copy;
+  }
+  return buffer;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
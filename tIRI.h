@@ -0,0 +1,192 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tIRI.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tIRI
+ *
+ * \b tIRI
+ *
+ * This class wraps a RFC 3987 IRI (Internationalized Resource Identifier):
+ * an URI that may contain non-ASCII characters (UTF-8 encoded) instead of their percent-encodings.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__tIRI_h__
+#define __rrlib__uri__tIRI_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tURI.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! IRI
+/*!
+ * This class wraps a RFC 3987 IRI (Internationalized Resource Identifier):
+ * an URI that may contain non-ASCII characters (UTF-8 encoded) instead of their percent-encodings - e.g. for display in user interfaces.
+ *
+ * Conversions in both directions validate UTF-8 in the same pass that encodes or decodes characters.
+ * Runs of ASCII characters are processed 16 at a time if SSE2 is available.
+ */
+class tIRI
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! IRI string (moved if an rvalue is passed) */
+  tIRI(std::string iri = std::string()) :
+    iri(std::move(iri))
+  {}
+  tIRI(const char* iri) :
+    iri(iri)
+  {}
+
+  /*!
+   * Creates IRI from URI: percent-encoded non-ASCII characters are decoded if they form valid UTF-8 (RFC 3987, section 3.2)
+   * and encode a character allowed in IRIs (ucschar - private use characters only in the query; no bidirectional formatting characters).
+   * All other percent-encodings (e.g. of reserved ASCII characters or non-characters) are left untouched.
+   */
+  explicit tIRI(const tURI& uri);
+
+  /*!
+   * Creates IRI from path (non-ASCII characters in path elements remain readable if they are valid UTF-8)
+   */
+  explicit tIRI(const tPath& path) :
+    tIRI(tURI(path))
+  {}
+
+  /*!
+   * Percent-decodes string and validates that result is UTF-8 (in a single pass)
+   *
+   * \param decode_buffer Buffer for decoded string. Should have a size >= encoded.Length()
+   * \param encoded Percent-encoded string
+   * \return Pointer to character after the last character written in decode_buffer (notably string in decode_buffer is not null-terminated)
+   * \throws std::invalid_argument if string cannot be decoded or decoded string is no valid UTF-8
+   */
+  static char* Decode(char* decode_buffer, const tStringRange& encoded);
+
+  /*!
+   * Converts IRI string to URI string (RFC 3987, section 3.1): non-ASCII characters are percent-encoded
+   *
+   * \param buffer Buffer for URI string. Should have a size >= URILength(iri)
+   * \param iri IRI string
+   * \return Pointer to character after the last character written in buffer (notably string in buffer is not null-terminated)
+   * \throws std::invalid_argument if IRI string is no valid UTF-8
+   */
+  static char* IRIToURI(char* buffer, const tStringRange& iri);
+
+  /*!
+   * \return Whether string is valid UTF-8 (RFC 3629)
+   */
+  static bool IsValidUTF8(const tStringRange& string);
+
+  /*!
+   * \return Exact number of characters IRIToURI() writes to buffer for this IRI string
+   */
+  static size_t URILength(const tStringRange& iri);
+
+  /*!
+   * Converts URI string to IRI string (see constructor)
+   *
+   * \param buffer Buffer for IRI string. Should have a size >= uri.Length()
+   * \param uri URI string
+   * \return Pointer to character after the last character written in buffer (notably string in buffer is not null-terminated)
+   */
+  static char* URIToIRI(char* buffer, const tStringRange& uri);
+
+  /*!
+   * \return IRI string
+   */
+  const std::string& ToString() const
+  {
+    return iri;
+  }
+
+  /*!
+   * \return URI corresponding to IRI (memory is allocated only once)
+   * \throws std::invalid_argument if IRI is no valid UTF-8
+   */
+  tURI ToURI() const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! IRI string */
+  std::string iri;
+};
+
+inline bool operator==(const tIRI& lhs, const tIRI& rhs)
+{
+  return lhs.ToString() == rhs.ToString();
+}
+
+inline bool operator!=(const tIRI& lhs, const tIRI& rhs)
+{
+  return !(lhs == rhs);
+}
+
+inline bool operator<(const tIRI& lhs, const tIRI& rhs)
+{
+  return lhs.ToString() < rhs.ToString();
+}
+
+inline std::ostream& operator << (std::ostream& stream, const tIRI& iri) // for command line output
+{
+  stream << iri.ToString();
+  return stream;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
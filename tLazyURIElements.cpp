@@ -0,0 +1,103 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tLazyURIElements.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/uri/tLazyURIElements.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+bool tLazyURIElements::PathEquals(const tPath& path)
+{
+  const char* encoded = view.path.CharPointer();
+  size_t length = view.path.Length();
+  if (path_decoded || (length && memchr(encoded, '%', length)))
+  {
+    return Path() == path;
+  }
+
+  // Without percent-encodings, the decoded path string equals the encoded one (apart from a trailing separator)
+  if (length == 0)
+  {
+    return path.Size() == 0 && (!path.IsAbsolute());
+  }
+  bool absolute = encoded[0] == '/';
+  size_t end = (length > 1 && encoded[length - 1] == '/') ? length - 1 : length;
+  if (path.ToStringRange() != tStringRange(encoded, end))
+  {
+    return false;
+  }
+
+  // Path elements must not contain slashes (possible if path was created from elements)
+  size_t element_count = length > (absolute ? 1 : 0) ? 1 : 0;
+  for (size_t i = 1; i < end; i++)
+  {
+    element_count += encoded[i] == '/' ? 1 : 0;
+  }
+  return path.Size() == element_count;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,214 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tLazyURIElements.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tLazyURIElements
+ *
+ * \b tLazyURIElements
+ *
+ * Variant of tURIElements that keeps the percent-encoded path - and decodes it only when it is first accessed.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__tLazyURIElements_h__
+#define __rrlib__uri__tLazyURIElements_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tURI.h"
+#include "rrlib/uri/tSchemeRegistry.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! URI elements with lazily decoded path
+/*!
+ * Variant of tURIElements for callers that often do not need the decoded path (e.g. only the scheme - or only compare paths).
+ * Scheme, authority, query, and fragment are string ranges referencing the URI string (as in tURIView).
+ * The path is decoded to a tPath when it is first accessed. PathEquals() compares paths without decoding if possible.
+ * The scheme's ID is looked up in tSchemeRegistry. Parse hooks are not called, as they fill tURIElements.
+ *
+ * Like tStringRange, it is only valid as long as the URI string is not modified.
+ */
+class tLazyURIElements
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tLazyURIElements() :
+    scheme_id(tSchemeID::UNKNOWN),
+    path_decoded(false)
+  {}
+
+  /*!
+   * \param uri URI string to split
+   */
+  explicit tLazyURIElements(const tStringRange& uri) :
+    tLazyURIElements()
+  {
+    Set(uri);
+  }
+
+  /*!
+   * \return Authority in URI (percent-encoded; empty range if no authority)
+   */
+  const tStringRange& Authority() const
+  {
+    return view.authority;
+  }
+
+  /*!
+   * \return Path in URI (percent-encoded; empty range if no path)
+   */
+  const tStringRange& EncodedPath() const
+  {
+    return view.path;
+  }
+
+  /*!
+   * \return Fragment in URI (percent-encoded; empty range if no fragment)
+   */
+  const tStringRange& Fragment() const
+  {
+    return view.fragment;
+  }
+
+  /*!
+   * \return Path in URI (decoded; empty path if no path). Path is decoded on first call.
+   * As this modifies internal state, it is non-const (call it once before sharing a const object across threads).
+   * \throw Throws std::invalid_argument if path cannot be decoded
+   */
+  const tPath& Path()
+  {
+    if (!path_decoded)
+    {
+      tURI::DecodePath(view.path, path);
+      path_decoded = true;
+    }
+    return path;
+  }
+
+  /*!
+   * Compares path in URI to specified path.
+   * If path has already been decoded - or encoded path contains no percent-encodings - nothing is decoded.
+   * Otherwise the path is decoded via Path() (so this is non-const as well).
+   *
+   * \param path Path to compare with
+   * \return Whether Path() == path
+   * \throw Throws std::invalid_argument if path needs to be decoded and cannot be decoded
+   */
+  bool PathEquals(const tPath& path);
+
+  /*!
+   * \return Query in URI (percent-encoded; empty range if no query)
+   */
+  const tStringRange& Query() const
+  {
+    return view.query;
+  }
+
+  /*!
+   * \return Scheme in URI (empty range if no scheme)
+   */
+  const tStringRange& Scheme() const
+  {
+    return view.scheme;
+  }
+
+  /*!
+   * \return ID of scheme in scheme registry (tSchemeID::UNKNOWN if scheme is not in registry)
+   */
+  tSchemeID SchemeID() const
+  {
+    return scheme_id;
+  }
+
+  /*!
+   * Splits URI string into its elements (does not decode path)
+   *
+   * \param uri URI string to split
+   */
+  void Set(const tStringRange& uri)
+  {
+    view.Set(uri);
+    scheme_id = tSchemeRegistry::GetID(view.scheme);
+    path_decoded = false;
+  }
+
+  /*!
+   * \return URI view with all elements (percent-encoded)
+   */
+  const tURIView& View() const
+  {
+    return view;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Elements of URI */
+  tURIView view;
+
+  /*! ID of scheme in scheme registry */
+  tSchemeID scheme_id;
+
+  /*! Decoded path (valid if path_decoded is true). Memory is reused when other URIs are set. */
+  tPath path;
+
+  /*! Whether path has been decoded */
+  bool path_decoded;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
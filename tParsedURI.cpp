@@ -0,0 +1,213 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tParsedURI.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/uri/tParsedURI.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/instrumentation.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tParsedURI::tParsedURI() :
+  scheme_length(0),
+  authority_length(0),
+  path_length(0),
+  query_length(0),
+  flags(0),
+  path_decoded(false)
+{}
+
+void tParsedURI::GetElements(tURIElements& result) const
+{
+  tURIView view = View();
+  result.scheme_id = tSchemeRegistry::GetID(view.scheme);
+  tSchemeRegistry::tParseHook parse_hook = tSchemeRegistry::GetParseHook(result.scheme_id);
+  if (parse_hook)
+  {
+    parse_hook(view, result, false);
+    return;
+  }
+  result.scheme.assign(view.scheme.CharPointer(), view.scheme.Length());
+  result.authority.assign(view.authority.CharPointer(), view.authority.Length());
+  if (path_decoded)
+  {
+    result.path = path;
+  }
+  else
+  {
+    tURI::DecodePath(view.path, result.path);
+  }
+  result.query.assign(view.query.CharPointer(), view.query.Length());
+  result.fragment.assign(view.fragment.CharPointer(), view.fragment.Length());
+}
+
+void tParsedURI::Set(const tURI& uri, bool decode_path)
+{
+  this->uri = uri;
+  tURIView view(this->uri.ToString());
+  scheme_length = view.scheme.Length();
+  authority_length = view.authority.Length();
+  path_length = view.path.Length();
+  query_length = view.query.Length();
+  flags = (view.has_authority ? cHAS_AUTHORITY : 0) | (view.has_query ? cHAS_QUERY : 0) | (view.has_fragment ? cHAS_FRAGMENT : 0);
+  path_decoded = false;
+  if (decode_path)
+  {
+    Path();
+  }
+}
+
+tURIView tParsedURI::View() const
+{
+  const std::string& uri_string = uri.ToString();
+  const char* current = uri_string.c_str();
+  const char* end = current + uri_string.length();
+  tURIView view;
+  view.has_authority = flags & cHAS_AUTHORITY;
+  view.has_query = flags & cHAS_QUERY;
+  view.has_fragment = flags & cHAS_FRAGMENT;
+  view.scheme = tStringRange(current, scheme_length);
+  current += scheme_length + (scheme_length ? 1 : 0) + (view.has_authority ? 2 : 0);
+  view.authority = tStringRange(current, authority_length);
+  current += authority_length;
+  view.path = tStringRange(current, path_length);
+  current += path_length + (view.has_query ? 1 : 0);
+  view.query = tStringRange(current, query_length);
+  current += query_length + (view.has_fragment ? 1 : 0);
+  view.fragment = tStringRange(current, end - current);
+  return view;
+}
+
+serialization::tOutputStream& operator << (serialization::tOutputStream& stream, const tParsedURI& uri)
+{
+  RRLIB_URI_INSTRUMENT(SERIALIZE, uri.uri.ToString().length());
+  stream << uri.uri.ToString();
+  stream.WriteByte(uri.flags);
+  stream.WriteInt(uri.scheme_length);
+  stream.WriteInt(uri.authority_length);
+  stream.WriteInt(uri.path_length);
+  stream.WriteInt(uri.query_length);
+  return stream;
+}
+
+serialization::tInputStream& operator >> (serialization::tInputStream& stream, tParsedURI& uri)
+{
+  RRLIB_URI_INSTRUMENT(DESERIALIZE, 0);
+  uri.uri.Set(stream.ReadString());
+  uri.flags = stream.ReadByte() & (tParsedURI::cHAS_AUTHORITY | tParsedURI::cHAS_QUERY | tParsedURI::cHAS_FRAGMENT);
+  uri.scheme_length = stream.ReadInt();
+  uri.authority_length = stream.ReadInt();
+  uri.path_length = stream.ReadInt();
+  uri.query_length = stream.ReadInt();
+  uri.path_decoded = false;
+
+  // Check that boundaries are consistent with URI string (so that views cannot reference memory outside of it).
+  // Each length is checked against the remaining characters before it is added - so position cannot overflow.
+  const std::string& uri_string = uri.uri.ToString();
+  const char* delimiters = uri_string.c_str();
+  size_t position = 0;
+  bool valid = ((uri.flags & tParsedURI::cHAS_AUTHORITY) || uri.authority_length == 0) && ((uri.flags & tParsedURI::cHAS_QUERY) || uri.query_length == 0);
+  auto advance = [&](size_t length)
+  {
+    valid = valid && length <= uri_string.length() - position;
+    position += valid ? length : 0;
+  };
+  auto delimiter = [&](char character)
+  {
+    valid = valid && position < uri_string.length() && delimiters[position] == character;
+    position += valid ? 1 : 0;
+  };
+  advance(uri.scheme_length);
+  if (uri.scheme_length)
+  {
+    delimiter(':');
+  }
+  if (uri.flags & tParsedURI::cHAS_AUTHORITY)
+  {
+    delimiter('/');
+    delimiter('/');
+  }
+  advance(uri.authority_length);
+  advance(uri.path_length);
+  if (uri.flags & tParsedURI::cHAS_QUERY)
+  {
+    delimiter('?');
+  }
+  advance(uri.query_length);
+  if (uri.flags & tParsedURI::cHAS_FRAGMENT)
+  {
+    delimiter('#');
+  }
+  valid = valid && ((uri.flags & tParsedURI::cHAS_FRAGMENT) || position == uri_string.length());
+  if (!valid)
+  {
+    uri.Set(tURI());
+    throw std::runtime_error("Invalid parsed URI");
+  }
+  return stream;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
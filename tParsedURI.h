@@ -0,0 +1,191 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tParsedURI.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tParsedURI
+ *
+ * \b tParsedURI
+ *
+ * URI together with the boundaries of its top-level elements (and optionally its decoded path).
+ * Its binary serialization contains these boundaries, so that receivers obtain a parsed URI without scanning the string again.
+ * The decoded path is not serialized - receivers decode it when it is first accessed.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__tParsedURI_h__
+#define __rrlib__uri__tParsedURI_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tURI.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Parsed URI
+/*!
+ * URI together with the boundaries of its top-level elements - and optionally its decoded path.
+ * Intended for passing URIs along multiple hops: the URI is split once by the first sender.
+ *
+ * Binary serialization contains the URI string and element lengths.
+ * Deserialization checks the element delimiters at the transferred boundaries only; it does not scan the URI string.
+ * The decoded path is not transferred (a receiver could not trust it without decoding the path anyway).
+ */
+class tParsedURI
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tParsedURI();
+
+  /*!
+   * \param uri URI to parse
+   * \param decode_path Whether to decode path immediately (see Set())
+   * \throw Throws std::invalid_argument if path is to be decoded and cannot be decoded
+   */
+  explicit tParsedURI(const tURI& uri, bool decode_path = false) :
+    tParsedURI()
+  {
+    Set(uri, decode_path);
+  }
+
+  /*!
+   * \return Whether path has been decoded
+   */
+  bool IsPathDecoded() const
+  {
+    return path_decoded;
+  }
+
+  /*!
+   * Fills tURIElements with the elements of this URI (without splitting the URI string)
+   * As in tURI::Parse, the scheme's parse hook fills the elements instead - if one is set in tSchemeRegistry.
+   * If the path has not been decoded yet, it is decoded to result.path (without modifying this object).
+   *
+   * \param result Object to store results in
+   * \throw Throws std::invalid_argument if path cannot be decoded
+   */
+  void GetElements(tURIElements& result) const;
+
+  /*!
+   * \return Path in URI (decoded; empty path if no path). Path is decoded on first call (unless it has been decoded already).
+   * As decoding modifies internal state, this is non-const (const objects shared across threads can use GetElements() - or be created with decode_path set).
+   * \throw Throws std::invalid_argument if path cannot be decoded
+   */
+  const tPath& Path()
+  {
+    if (!path_decoded)
+    {
+      tURI::DecodePath(View().path, path);
+      path_decoded = true;
+    }
+    return path;
+  }
+
+  /*!
+   * Parses URI
+   *
+   * \param uri URI to parse
+   * \param decode_path Whether to decode path immediately
+   * \throw Throws std::invalid_argument if path is to be decoded and cannot be decoded
+   */
+  void Set(const tURI& uri, bool decode_path = false);
+
+  /*!
+   * \return URI
+   */
+  const tURI& URI() const
+  {
+    return uri;
+  }
+
+  /*!
+   * \return View on top-level elements of URI (percent-encoded; created from stored boundaries - without scanning the URI string)
+   */
+  tURIView View() const;
+
+  friend serialization::tOutputStream& operator << (serialization::tOutputStream& stream, const tParsedURI& uri);
+  friend serialization::tInputStream& operator >> (serialization::tInputStream& stream, tParsedURI& uri);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  enum tFlag : uint8_t
+  {
+    cHAS_AUTHORITY = 1,
+    cHAS_QUERY = 2,
+    cHAS_FRAGMENT = 4
+  };
+
+  /*! URI */
+  tURI uri;
+
+  /*! Lengths of scheme, authority, path, and query (fragment is the remainder of the URI string) */
+  uint scheme_length, authority_length, path_length, query_length;
+
+  /*! Flags (see tFlag) */
+  uint8_t flags;
+
+  /*! Decoded path (valid if path_decoded is true) */
+  tPath path;
+
+  /*! Whether path has been decoded */
+  bool path_decoded;
+};
+
+serialization::tOutputStream& operator << (serialization::tOutputStream& stream, const tParsedURI& uri);
+serialization::tInputStream& operator >> (serialization::tInputStream& stream, tParsedURI& uri);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -32,11 +32,14 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <memory>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/uri/tURI.h"
+#include "rrlib/uri/tPathView.h"
+#include "rrlib/uri/instrumentation.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -64,6 +67,9 @@ namespace uri
 //----------------------------------------------------------------------
 static const size_t cDESERIALIZATION_SIZE_LIMIT = 50000;
 
+/*! Maximum number of path elements Set() can handle without allocating temporary memory */
+static const size_t cSET_STACK_BUFFER_ELEMENTS = 128;
+
 //----------------------------------------------------------------------
 // Implementation
 //----------------------------------------------------------------------
@@ -93,8 +99,24 @@ static size_t Normalize(tStringRange* buffer, size_t size)
 }
 
 
+tPath::tPath(const tPathView& path_view) :
+  element_count(path_view.Size())
+{
+  if (element_count == 0 && (!path_view.IsAbsolute()))
+  {
+    return;
+  }
+  size_t table_size = (element_count + 1) * sizeof(uint);
+  size_t total_characters = path_view.TotalCharacters();
+  memory.resize(table_size + total_characters);
+  memcpy(&memory[0], path_view.element_offsets, table_size);
+  memcpy(&memory[table_size], path_view.path_string, total_characters);
+}
+
 tPath tPath::Append(const tPath& append) const
 {
+  RRLIB_URI_INSTRUMENT(PATH_APPEND, TotalCharacters() + append.TotalCharacters());
+  RRLIB_URI_INSTRUMENT_ALLOCATIONS(1);
   tStringRange buffer[Size() + append.Size()];
   for (size_t i = 0; i < Size(); i++)
   {
@@ -108,52 +130,139 @@ tPath tPath::Append(const tPath& append) const
   return tPath(IsAbsolute(), &buffer[0], &buffer[size]);
 }
 
-void tPath::Set(const tStringRange& path_string, char separator)
+void tPath::Set(const tStringRange& path_string, char separator, bool normalize)
 {
-  bool absolute = path_string.CharPointer()[0] == separator;
+  RRLIB_URI_INSTRUMENT(PATH_SET, path_string.Length());
+  const char* string = path_string.CharPointer();
+  size_t length = path_string.Length();
+  bool absolute = length && string[0] == separator;
   size_t start_index = absolute ? 1 : 0;
-  size_t end_index = path_string.Length() - (path_string.CharPointer()[path_string.Length() - 1] == separator ? 1 : 0);
-
-  // Create element table
-  element_count = 1;
-  uint elements[path_string.Length() + 1];
-  elements[0] = start_index;
+  size_t end_index = std::max(start_index, length - (length > start_index && string[length - 1] == separator ? 1 : 0));
+  if (length == start_index)
+  {
+    SetEmpty(absolute);
+    return;
+  }
 
-  for (size_t i = 1; i < end_index; i++)
+  // Scan for separators: store begin and length of each element in path_string (in stack buffer - or on heap if path has many elements)
+  size_t max_elements = end_index - start_index + 1;
+  uint stack_buffer[2 * cSET_STACK_BUFFER_ELEMENTS];
+  std::unique_ptr<uint[]> heap_buffer(max_elements <= cSET_STACK_BUFFER_ELEMENTS ? nullptr : new uint[2 * max_elements]);
+  uint* element_begins = heap_buffer ? heap_buffer.get() : stack_buffer;
+  uint* element_lengths = element_begins + max_elements;
+  size_t new_element_count = 0;
+  size_t total_characters = start_index + 1;
+  bool contiguous = true;  // whether elements have remained unchanged (and can be copied in one block)
+  for (size_t element_begin = start_index; element_begin <= end_index;)
   {
-    if (path_string.CharPointer()[i] == separator)
+    const char* separator_position = static_cast<const char*>(memchr(string + element_begin, separator, end_index - element_begin));
+    size_t element_end = separator_position ? separator_position - string : end_index;
+    size_t element_length = element_end - element_begin;
+    if (normalize && (element_length == 1 || element_length == 2) && string[element_begin] == '.' && string[element_end - 1] == '.')
     {
-      elements[element_count] = i + 1;
-      element_count++;
+      // Dot segment: "." is removed; ".." removes the previous element
+      contiguous = false;
+      if (element_length == 2 && new_element_count)
+      {
+        new_element_count--;
+        total_characters -= element_lengths[new_element_count] + 1;
+      }
+    }
+    else
+    {
+      element_begins[new_element_count] = element_begin;
+      element_lengths[new_element_count] = element_length;
+      new_element_count++;
+      total_characters += element_length + 1;
     }
+    element_begin = element_end + 1;
   }
-  elements[element_count] = end_index + 1;
+  if (new_element_count == 0)
+  {
+    SetEmpty(absolute);
+    return;
+  }
+  total_characters--; // last element is followed by the terminator instead of a separator
 
-  // Allocate and fill memory
-  size_t table_size = (element_count + 1) * sizeof(uint);
-  size_t required_memory = table_size + end_index + 1; // +1 for terminating null character
+  // Allocate memory and write table and elements directly to it
+  size_t table_size = (new_element_count + 1) * sizeof(uint);
+  size_t required_memory = table_size + total_characters;
+  RRLIB_URI_INSTRUMENT_ALLOCATIONS((required_memory > memory.capacity() ? 1 : 0) + (heap_buffer ? 1 : 0));
   memory.resize(required_memory);
-  memcpy(&memory[0], elements, table_size);
-  memcpy(&memory[table_size], path_string.CharPointer(), end_index);
-  if (separator != '/')
+  element_count = new_element_count;
+  uint* table = reinterpret_cast<uint*>(&memory[0]);
+  char* buffer = &memory[table_size];
+  if (absolute)
+  {
+    buffer[0] = '/';
+  }
+  if (contiguous)
   {
-    if (absolute)
+    memcpy(buffer + start_index, string + start_index, total_characters - 1 - start_index);
+    memcpy(table, element_begins, element_count * sizeof(uint));
+    for (size_t i = 1; i < element_count; i++)
+    {
+      buffer[table[i] - 1] = '/';
+    }
+  }
+  else
+  {
+    size_t offset = start_index;
+    for (size_t i = 0; i < element_count; i++)
     {
-      memory[table_size] = '/';
+      table[i] = offset;
+      memcpy(buffer + offset, string + element_begins[i], element_lengths[i]);
+      offset += element_lengths[i];
+      buffer[offset] = '/';
+      offset++;
     }
+  }
+  table[element_count] = total_characters;
+  buffer[total_characters - 1] = 0; // Null-terminator
+}
+
+void tPath::SetEmpty(bool absolute)
+{
+  element_count = 0;
+  if (!absolute)
+  {
+    memory.clear();
+    return;
+  }
+  const uint table[1] = { 2 };
+  memory.resize(sizeof(table) + 2);
+  memcpy(&memory[0], table, sizeof(table));
+  memory[sizeof(table)] = '/';
+  memory[sizeof(table) + 1] = 0;
+}
+
+char* tPath::WriteString(char* buffer, char separator) const
+{
+  size_t length = TotalCharacters() - 1;
+  memcpy(buffer, GetPathStringBegin(), length);
+  buffer[length] = 0;
+  if (separator != '/' && memory.size())
+  {
+    // Replace separators only (elements may contain slashes)
+    if (IsAbsolute())
+    {
+      buffer[0] = separator;
+    }
+    const uint* table = GetElementOffsetTable();
     for (size_t i = 1; i < element_count; i++)
     {
-      memory[table_size + elements[i] - 1] = '/';
+      buffer[table[i] - 1] = separator;
     }
   }
-  memory[required_memory - 1] = 0; // Null-terminator
+  return buffer + length;
 }
 
 
 serialization::tOutputStream& operator << (serialization::tOutputStream& stream, const tPath& path)
 {
+  RRLIB_URI_INSTRUMENT(SERIALIZE, path.TotalCharacters());
   size_t size = path.Size();
-  stream.WriteInt(path.TotalCharacters());
+  stream.WriteInt(size ? path.TotalCharacters() : (path.IsAbsolute() ? 1 : 0)); // number of bytes written below
   if (path.IsAbsolute())
   {
     stream.WriteByte(0);
@@ -168,10 +277,16 @@ serialization::tOutputStream& operator << (serialization::tOutputStream& stream,
 serialization::tInputStream& operator >> (serialization::tInputStream& stream, tPath& path)
 {
   size_t size = stream.ReadInt();
+  RRLIB_URI_INSTRUMENT(DESERIALIZE, size);
   if (size > cDESERIALIZATION_SIZE_LIMIT)
   {
     throw std::runtime_error("Size limit for path deserialization exceeded");
   }
+  if (size == 0)
+  {
+    path.Clear();
+    return stream;
+  }
   char buffer[size];
   stream.ReadFully(buffer, size);
   path.Set(tStringRange(buffer, size), 0);
@@ -180,12 +295,14 @@ serialization::tInputStream& operator >> (serialization::tInputStream& stream, t
 
 serialization::tStringOutputStream& operator << (serialization::tStringOutputStream& stream, const tPath& path)
 {
-  stream << tURI(path);
+  RRLIB_URI_INSTRUMENT(SERIALIZE, path.TotalCharacters());
+  tURI::Write(stream, path);
   return stream;
 }
 
 serialization::tStringInputStream& operator >> (serialization::tStringInputStream& stream, tPath& path)
 {
+  RRLIB_URI_INSTRUMENT(DESERIALIZE, 0);
   tURIElements elements;
   tURI uri;
   stream >> uri;
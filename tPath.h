@@ -61,6 +61,7 @@ namespace uri
 //----------------------------------------------------------------------
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
+class tPathView;
 
 //----------------------------------------------------------------------
 // Class declaration
@@ -96,14 +97,15 @@ public:
    *
    * \param path_string String (e.g. /element1/element2)
    * \param separator Separator of path elements
+   * \param normalize Whether to remove '.' and '..' elements (see Set())
    */
-  tPath(const tStringRange& path_string, char separator = '/') :
+  tPath(const tStringRange& path_string, char separator = '/', bool normalize = false) :
     tPath()
   {
-    Set(path_string, separator);
+    Set(path_string, separator, normalize);
   }
-  tPath(const std::string& path_string, char separator = '/') : tPath(tStringRange(path_string)) {}
-  tPath(const char* path_string, char separator = '/') : tPath(tStringRange(path_string)) {}
+  tPath(const std::string& path_string, char separator = '/', bool normalize = false) : tPath(tStringRange(path_string), separator, normalize) {}
+  tPath(const char* path_string, char separator = '/', bool normalize = false) : tPath(tStringRange(path_string), separator, normalize) {}
 
   /*!
    * Constructs path from iterator over string elements - e.g.
@@ -121,6 +123,13 @@ public:
     Set(absolute, begin, end);
   }
 
+  /*!
+   * Constructs path from path view (copies the view's memory block)
+   *
+   * \param path_view Path view
+   */
+  explicit tPath(const tPathView& path_view);
+
   /*!
    * Append path to this path (possibly eliminating '..' and '.' entries)
    *
@@ -162,6 +171,14 @@ public:
     return max;
   }
 
+  /*!
+   * \return Path as null-terminated string with elements separated by slashes (e.g. /element1/element2). Valid as long as path is not modified.
+   */
+  const char* CString() const
+  {
+    return GetPathStringBegin();
+  }
+
   /*!
    * \return End iterator for path elements
    */
@@ -172,10 +189,11 @@ public:
 
   /*!
    * \return Whether this is an abolute path
+   * (the first element's offset is checked - as relative paths with an empty first element also start with a separator)
    */
   bool IsAbsolute() const
   {
-    return GetPathStringBegin()[0] == '/';
+    return element_count ? GetElementOffsetTable()[0] == 1 : GetPathStringBegin()[0] == '/';
   }
 
   /*!
@@ -195,12 +213,16 @@ public:
   }
 
   /*!
-   * Sets path elements from string
+   * Sets path elements from string.
+   * A leading separator makes the path absolute; a trailing separator is ignored.
+   * Only "" and "/" yield paths without elements - every other separator separates two (possibly empty) elements:
+   * "//" has one empty element, "///" two, and "a//" has the elements "a" and "".
    *
    * \param path_string String (e.g. /element1/element2)
    * \param separator Separator of path elements
+   * \param normalize Whether to remove '.' and '..' elements (as Append() does). This is done during the scan for separators - so it costs hardly anything.
    */
-  void Set(const tStringRange& path_string, char separator);
+  void Set(const tStringRange& path_string, char separator, bool normalize = false);
 
   /*!
    * Sets path elements from iterator - e.g.
@@ -214,6 +236,11 @@ public:
   template <typename TStringIterator>
   void Set(bool absolute, TStringIterator begin, TStringIterator end)
   {
+    if (begin == end)
+    {
+      SetEmpty(absolute);
+      return;
+    }
     element_count = end - begin;
 
     // Create element table
@@ -259,14 +286,42 @@ public:
     return element_count;
   }
 
+  /*!
+   * \return Path string with elements separated by slashes (references path's memory - followed by a terminating zero)
+   */
+  tStringRange ToStringRange() const
+  {
+    return tStringRange(GetPathStringBegin(), TotalCharacters() - 1);
+  }
+
+  /*!
+   * \param separator Separator of path elements in string
+   * \return Path as string (e.g. /element1/element2 with separator '/')
+   */
+  std::string ToString(char separator = '/') const
+  {
+    std::string result(TotalCharacters() - 1, 0);
+    WriteString(&result[0], separator);
+    return result;
+  }
+
   /*!
    * \return Total number of characters in path - including separators and terminator
    */
   size_t TotalCharacters() const
   {
-    return memory.size() - (element_count + 1) * sizeof(uint);
+    return memory.size() ? memory.size() - (element_count + 1) * sizeof(uint) : 1;
   }
 
+  /*!
+   * Writes path string to buffer - using the specified separator for path elements (e.g. '.' for element1.element2)
+   *
+   * \param buffer Buffer to write to. Must have a size >= TotalCharacters().
+   * \param separator Separator of path elements
+   * \return Pointer to terminating zero written to buffer
+   */
+  char* WriteString(char* buffer, char separator = '/') const;
+
   friend bool operator==(const tPath& lhs, const tPath& rhs)
   {
     return lhs.element_count == rhs.element_count && lhs.memory == rhs.memory;
@@ -283,7 +338,7 @@ public:
   }
   friend inline std::ostream& operator << (std::ostream& stream, const tPath& path) // for command line output
   {
-    stream.write(path.GetPathStringBegin(), &path.memory.back() - path.GetPathStringBegin());
+    stream.write(path.GetPathStringBegin(), path.TotalCharacters() - 1);
     return stream;
   }
 
@@ -365,6 +420,8 @@ public:
 //----------------------------------------------------------------------
 private:
 
+  friend class tPathView;
+
   /*! Number of elements in path */
   size_t element_count;
 
@@ -409,6 +466,13 @@ private:
     return memory.size() ? &memory[(element_count + 1) * sizeof(uint)] : "\0";
   }
 
+  /*!
+   * Sets path to path without elements
+   *
+   * \param absolute Whether path is absolute ("/") - or relative ("")
+   */
+  void SetEmpty(bool absolute);
+
   /*!
    * \param string String to obtain length from
    * \return String length
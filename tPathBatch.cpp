@@ -0,0 +1,192 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tPathBatch.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/uri/tPathBatch.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+static const size_t cDESERIALIZATION_SIZE_LIMIT = 1 << 28;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+void tPathBatch::Append(const tPathView& path)
+{
+  size_t total_characters = path.TotalCharacters();
+  const char* path_string = path.ToStringRange().CharPointer();
+  tEntry entry = { static_cast<uint>(element_offsets.size()), static_cast<uint>(characters.size()), static_cast<uint>(path.Size()) };
+  for (size_t i = 0; i < path.Size(); i++)
+  {
+    element_offsets.push_back(path[i].CharPointer() - path_string);
+  }
+  element_offsets.push_back(total_characters);
+  characters.insert(characters.end(), path_string, path_string + total_characters);
+  entries.push_back(entry);
+}
+
+void tPathBatch::Append(const tStringRange& path_string, char separator)
+{
+  const char* string = path_string.CharPointer();
+  size_t length = path_string.Length();
+  bool absolute = length && string[0] == separator;
+  size_t start_index = absolute ? 1 : 0;
+  size_t end_index = std::max(start_index, length - (length > start_index && string[length - 1] == separator ? 1 : 0));
+
+  tEntry entry = { static_cast<uint>(element_offsets.size()), static_cast<uint>(characters.size()), 0 };
+  size_t character_offset = characters.size();
+  characters.resize(character_offset + end_index + 1);
+  char* buffer = &characters[character_offset];
+  if (absolute)
+  {
+    buffer[0] = '/';
+  }
+  if (length > start_index)
+  {
+    element_offsets.push_back(start_index);
+    entry.element_count = 1;
+    for (size_t i = start_index; i < end_index; i++)
+    {
+      if (string[i] == separator)
+      {
+        buffer[i] = '/';
+        element_offsets.push_back(i + 1);
+        entry.element_count++;
+      }
+      else
+      {
+        buffer[i] = string[i];
+      }
+    }
+  }
+  buffer[end_index] = 0;
+  element_offsets.push_back(end_index + 1);
+  entries.push_back(entry);
+}
+
+serialization::tOutputStream& operator << (serialization::tOutputStream& stream, const tPathBatch& batch)
+{
+  stream.WriteInt(batch.entries.size());
+  stream.WriteInt(batch.element_offsets.size());
+  stream.WriteInt(batch.characters.size());
+  for (const tPathBatch::tEntry & entry : batch.entries)
+  {
+    stream.WriteInt(entry.element_offsets);
+    stream.WriteInt(entry.characters);
+    stream.WriteInt(entry.element_count);
+  }
+  for (uint offset : batch.element_offsets)
+  {
+    stream.WriteInt(offset);
+  }
+  stream.Write(batch.characters.data(), batch.characters.size());
+  return stream;
+}
+
+serialization::tInputStream& operator >> (serialization::tInputStream& stream, tPathBatch& batch)
+{
+  size_t entry_count = static_cast<uint>(stream.ReadInt());
+  size_t offset_count = static_cast<uint>(stream.ReadInt());
+  size_t character_count = static_cast<uint>(stream.ReadInt());
+  if (entry_count > cDESERIALIZATION_SIZE_LIMIT || offset_count > cDESERIALIZATION_SIZE_LIMIT || character_count > cDESERIALIZATION_SIZE_LIMIT)
+  {
+    throw std::runtime_error("Size limit for path batch deserialization exceeded");
+  }
+  batch.Clear();
+  batch.entries.resize(entry_count);
+  for (tPathBatch::tEntry & entry : batch.entries)
+  {
+    entry.element_offsets = stream.ReadInt();
+    entry.characters = stream.ReadInt();
+    entry.element_count = stream.ReadInt();
+  }
+  batch.element_offsets.resize(offset_count);
+  for (uint & offset : batch.element_offsets)
+  {
+    offset = stream.ReadInt();
+  }
+  batch.characters.resize(character_count);
+  stream.ReadFully(batch.characters.data(), character_count);
+
+  // Validate, so that views cannot reference memory outside of buffers
+  for (const tPathBatch::tEntry & entry : batch.entries)
+  {
+    bool valid = entry.element_offsets < offset_count && entry.element_count < offset_count - entry.element_offsets && entry.characters < character_count;
+    const uint* offsets = valid ? &batch.element_offsets[entry.element_offsets] : nullptr;
+    valid = valid && offsets[entry.element_count] > 0 && offsets[entry.element_count] <= character_count - entry.characters &&
+            batch.characters[entry.characters + offsets[entry.element_count] - 1] == 0;
+    for (size_t i = 0; valid && i < entry.element_count; i++)
+    {
+      valid = offsets[i] < offsets[i + 1];
+    }
+    if (!valid)
+    {
+      batch.Clear();
+      throw std::runtime_error("Invalid path batch");
+    }
+  }
+  return stream;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,219 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tPathBatch.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tPathBatch
+ *
+ * \b tPathBatch
+ *
+ * Container for many paths.
+ * All paths are stored in one shared character buffer and one shared element offset table.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__tPathBatch_h__
+#define __rrlib__uri__tPathBatch_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tPathView.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Batch of paths
+/*!
+ * Container for many paths.
+ * In contrast to std::vector<tPath>, paths do not allocate memory individually:
+ * all path strings are stored in one shared character buffer and all element offset tables in one shared offset buffer
+ * (with the same layout as in tPath). For each path, only an entry with indices into these buffers is stored.
+ * This results in contiguous memory and much less overhead per path.
+ *
+ * Paths are accessed as tPathViews. These are invalidated when paths are appended to the batch or the batch is cleared.
+ * Paths cannot be removed individually.
+ */
+class tPathBatch
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tPathBatch()
+  {}
+
+  /*!
+   * Appends path to batch
+   *
+   * \param path Path to append (a tPath can be passed as well)
+   */
+  void Append(const tPathView& path);
+
+  /*!
+   * Appends path to batch - parsing it directly into the batch's buffers (without creating a temporary tPath)
+   *
+   * \param path_string String (e.g. /element1/element2)
+   * \param separator Separator of path elements
+   */
+  void Append(const tStringRange& path_string, char separator = '/');
+
+  /*!
+   * Clear batch (keeps allocated memory)
+   */
+  void Clear()
+  {
+    entries.clear();
+    element_offsets.clear();
+    characters.clear();
+  }
+
+  /*!
+   * Reserves memory so that paths can be appended without reallocation
+   *
+   * \param path_count Number of paths
+   * \param element_count Total number of elements in paths
+   * \param character_count Total number of characters in paths (including separators and terminators)
+   */
+  void Reserve(size_t path_count, size_t element_count, size_t character_count)
+  {
+    entries.reserve(path_count);
+    element_offsets.reserve(element_count + path_count);
+    characters.reserve(character_count);
+  }
+
+  /*!
+   * \return Number of paths in batch
+   */
+  size_t Size() const
+  {
+    return entries.size();
+  }
+
+  /*!
+   * Sorts paths by path string.
+   * Only path entries are reordered - character and offset buffers are not modified.
+   */
+  void Sort()
+  {
+    Sort([](const tPathView & lhs, const tPathView & rhs)
+    {
+      tStringRange lhs_string = lhs.ToStringRange();
+      tStringRange rhs_string = rhs.ToStringRange();
+      int result = memcmp(lhs_string.CharPointer(), rhs_string.CharPointer(), std::min(lhs_string.Length(), rhs_string.Length()));
+      return result != 0 ? result < 0 : (lhs_string.Length() != rhs_string.Length() ? lhs_string.Length() < rhs_string.Length() : lhs.Size() < rhs.Size());
+    });
+  }
+
+  /*!
+   * Sorts paths using the specified comparator.
+   * Only path entries are reordered - character and offset buffers are not modified.
+   *
+   * \param compare Comparator with signature bool(const tPathView&, const tPathView&)
+   */
+  template <typename TCompare>
+  void Sort(TCompare compare)
+  {
+    std::sort(entries.begin(), entries.end(), [this, &compare](const tEntry & lhs, const tEntry & rhs)
+    {
+      return compare(GetView(lhs), GetView(rhs));
+    });
+  }
+
+  /*!
+   * \param index Path index (< Size())
+   * \return View on path (valid until batch is modified)
+   */
+  tPathView operator[](size_t index) const
+  {
+    return GetView(entries[index]);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  friend serialization::tOutputStream& operator << (serialization::tOutputStream& stream, const tPathBatch& batch);
+  friend serialization::tInputStream& operator >> (serialization::tInputStream& stream, tPathBatch& batch);
+
+  /*! Path entry */
+  struct tEntry
+  {
+    uint element_offsets;  //!< Index of path's element offset table in 'element_offsets'
+    uint characters;       //!< Index of path's string in 'characters'
+    uint element_count;    //!< Number of elements in path
+  };
+
+  /*! Path entries */
+  std::vector<tEntry> entries;
+
+  /*! Element offset tables of all paths (same format as in tPath) */
+  std::vector<uint> element_offsets;
+
+  /*! Path strings of all paths (separated with slashes and null-terminated) */
+  std::vector<char> characters;
+
+  /*!
+   * \param entry Path entry
+   * \return View on path
+   */
+  tPathView GetView(const tEntry& entry) const
+  {
+    return tPathView(&element_offsets[entry.element_offsets], &characters[entry.characters], entry.element_count);
+  }
+};
+
+serialization::tOutputStream& operator << (serialization::tOutputStream& stream, const tPathBatch& batch);
+serialization::tInputStream& operator >> (serialization::tInputStream& stream, tPathBatch& batch);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,336 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tPathDictionary.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/uri/tPathDictionary.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+struct tPathDictionary::tPathRecord
+{
+  uint32_t element_offsets;  //!< Index of element offset table in element offset section
+  uint32_t path_string;      //!< Offset of path string in string pool
+  uint32_t element_count;    //!< Number of elements in path
+};
+
+namespace
+{
+
+struct tFileHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t path_count;
+  uint32_t element_offset_count;
+  uint32_t hash_index_size;
+  uint32_t string_pool_size;
+  uint32_t reserved;
+};
+
+}
+
+static_assert(sizeof(uint) == sizeof(uint32_t), "Element offset tables are stored as 32 bit values");
+static_assert(sizeof(tFileHeader) % sizeof(uint32_t) == 0, "Sections must remain aligned");
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const size_t tPathDictionary::cNOT_FOUND;
+
+static const char cMAGIC[8] = { 'R', 'R', 'L', 'I', 'B', 'P', 'D', 0 };
+static const uint32_t cVERSION = 1;
+static const uint32_t cEMPTY_SLOT = 0xFFFFFFFF;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tPathDictionary::tPathDictionary(const std::string& file_name) :
+  mapped_memory(MAP_FAILED),
+  mapped_size(0),
+  path_count(0),
+  records(nullptr),
+  element_offsets(nullptr),
+  hash_index(nullptr),
+  hash_index_size(0),
+  string_pool(nullptr)
+{
+  int file_descriptor = open(file_name.c_str(), O_RDONLY);
+  if (file_descriptor < 0)
+  {
+    throw std::runtime_error("Could not open path dictionary '" + file_name + "': " + strerror(errno));
+  }
+  struct stat file_status;
+  if (fstat(file_descriptor, &file_status) != 0 || static_cast<size_t>(file_status.st_size) < sizeof(tFileHeader))
+  {
+    close(file_descriptor);
+    throw std::runtime_error("Invalid path dictionary '" + file_name + "'");
+  }
+  mapped_size = file_status.st_size;
+  mapped_memory = mmap(nullptr, mapped_size, PROT_READ, MAP_SHARED, file_descriptor, 0);
+  close(file_descriptor);
+  if (mapped_memory == MAP_FAILED)
+  {
+    throw std::runtime_error("Could not map path dictionary '" + file_name + "': " + strerror(errno));
+  }
+
+  // Section offsets are computed with 64 bit values, so that they cannot overflow (header values are 32 bit)
+  const tFileHeader& header = *static_cast<const tFileHeader*>(mapped_memory);
+  uint64_t records_offset = sizeof(tFileHeader);
+  uint64_t element_offsets_offset = records_offset + static_cast<uint64_t>(header.path_count) * sizeof(tPathRecord);
+  uint64_t hash_index_offset = element_offsets_offset + static_cast<uint64_t>(header.element_offset_count) * sizeof(uint32_t);
+  uint64_t string_pool_offset = hash_index_offset + static_cast<uint64_t>(header.hash_index_size) * sizeof(uint32_t);
+  if (memcmp(header.magic, cMAGIC, sizeof(cMAGIC)) != 0 || header.version != cVERSION ||
+      header.hash_index_size == 0 || (header.hash_index_size & (header.hash_index_size - 1)) != 0 ||
+      string_pool_offset + header.string_pool_size != mapped_size)
+  {
+    munmap(mapped_memory, mapped_size);
+    throw std::runtime_error("Invalid path dictionary '" + file_name + "'");
+  }
+
+  const char* memory = static_cast<const char*>(mapped_memory);
+  path_count = header.path_count;
+  records = reinterpret_cast<const tPathRecord*>(memory + records_offset);
+  element_offsets = reinterpret_cast<const uint*>(memory + element_offsets_offset);
+  hash_index = reinterpret_cast<const uint32_t*>(memory + hash_index_offset);
+  hash_index_size = header.hash_index_size;
+  string_pool = memory + string_pool_offset;
+
+  // Validate, so that views cannot reference memory outside of file and Find() terminates
+  bool valid = true;
+  bool empty_slot = false;
+  for (size_t slot = 0; valid && slot < hash_index_size; slot++)
+  {
+    empty_slot |= hash_index[slot] == cEMPTY_SLOT;
+    valid = hash_index[slot] == cEMPTY_SLOT || hash_index[slot] < path_count;
+  }
+  valid = valid && empty_slot;
+  const size_t offset_count = header.element_offset_count;
+  const size_t string_pool_size = header.string_pool_size;
+  for (size_t i = 0; valid && i < path_count; i++)
+  {
+    const tPathRecord& record = records[i];
+    valid = record.element_offsets < offset_count && record.element_count < offset_count - record.element_offsets && record.path_string < string_pool_size;
+    const uint* offsets = valid ? &element_offsets[record.element_offsets] : nullptr;
+    valid = valid && offsets[record.element_count] > 0 && offsets[record.element_count] <= string_pool_size - record.path_string &&
+            string_pool[record.path_string + offsets[record.element_count] - 1] == 0;
+    for (size_t j = 0; valid && j < record.element_count; j++)
+    {
+      valid = offsets[j] < offsets[j + 1];
+    }
+  }
+  if (!valid)
+  {
+    munmap(mapped_memory, mapped_size);
+    throw std::runtime_error("Invalid path dictionary '" + file_name + "'");
+  }
+}
+
+tPathDictionary::~tPathDictionary()
+{
+  munmap(mapped_memory, mapped_size);
+}
+
+size_t tPathDictionary::Find(const tPathView& path) const
+{
+  for (size_t slot = Hash(path) & (hash_index_size - 1); hash_index[slot] != cEMPTY_SLOT; slot = (slot + 1) & (hash_index_size - 1))
+  {
+    if ((*this)[hash_index[slot]] == path)
+    {
+      return hash_index[slot];
+    }
+  }
+  return cNOT_FOUND;
+}
+
+uint32_t tPathDictionary::Hash(const tPathView& path)
+{
+  tStringRange path_string = path.ToStringRange();
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < path_string.Length(); i++)
+  {
+    hash = (hash ^ static_cast<unsigned char>(path_string.CharPointer()[i])) * 16777619u;
+  }
+  return hash;
+}
+
+bool tPathDictionary::Less(const tPathView& lhs, const tPathView& rhs)
+{
+  tStringRange lhs_string = lhs.ToStringRange();
+  tStringRange rhs_string = rhs.ToStringRange();
+  int result = memcmp(lhs_string.CharPointer(), rhs_string.CharPointer(), std::min(lhs_string.Length(), rhs_string.Length()));
+  if (result != 0)
+  {
+    return result < 0;
+  }
+  if (lhs_string.Length() != rhs_string.Length())
+  {
+    return lhs_string.Length() < rhs_string.Length();
+  }
+  return lhs.Size() < rhs.Size();  // Elements may contain slashes if paths were constructed from element lists
+}
+
+size_t tPathDictionary::LowerBound(const tPathView& path) const
+{
+  size_t first = 0;
+  size_t count = path_count;
+  while (count > 0)
+  {
+    size_t step = count / 2;
+    if (Less((*this)[first + step], path))
+    {
+      first += step + 1;
+      count -= step + 1;
+    }
+    else
+    {
+      count = step;
+    }
+  }
+  return first;
+}
+
+void tPathDictionary::Write(const std::string& file_name, const std::vector<tPath>& paths)
+{
+  std::vector<tPathView> sorted_paths(paths.begin(), paths.end());
+  std::sort(sorted_paths.begin(), sorted_paths.end(), Less);
+  sorted_paths.erase(std::unique(sorted_paths.begin(), sorted_paths.end()), sorted_paths.end());
+
+  // Create sections
+  std::vector<tPathRecord> path_records;
+  std::vector<uint32_t> offset_tables;
+  std::vector<char> string_pool;
+  path_records.reserve(sorted_paths.size());
+  for (const tPathView& path : sorted_paths)
+  {
+    tStringRange path_string = path.ToStringRange();
+    if (string_pool.size() + path_string.Length() + 1 > cEMPTY_SLOT || offset_tables.size() + path.Size() + 1 > cEMPTY_SLOT)
+    {
+      throw std::invalid_argument("Paths exceed maximum path dictionary size");
+    }
+    tPathRecord record = { static_cast<uint32_t>(offset_tables.size()), static_cast<uint32_t>(string_pool.size()), static_cast<uint32_t>(path.Size()) };
+    path_records.push_back(record);
+    for (size_t i = 0; i < path.Size(); i++)
+    {
+      offset_tables.push_back(path[i].CharPointer() - path_string.CharPointer());
+    }
+    offset_tables.push_back(path_string.Length() + 1);
+    string_pool.insert(string_pool.end(), path_string.CharPointer(), path_string.CharPointer() + path_string.Length());
+    string_pool.push_back(0);
+  }
+
+  // Create hash index (load factor <= 0.5)
+  size_t hash_index_size = 2;
+  while (hash_index_size < 2 * sorted_paths.size())
+  {
+    hash_index_size *= 2;
+  }
+  std::vector<uint32_t> hash_index(hash_index_size, cEMPTY_SLOT);
+  for (size_t i = 0; i < sorted_paths.size(); i++)
+  {
+    size_t slot = Hash(sorted_paths[i]) & (hash_index_size - 1);
+    while (hash_index[slot] != cEMPTY_SLOT)
+    {
+      slot = (slot + 1) & (hash_index_size - 1);
+    }
+    hash_index[slot] = i;
+  }
+
+  // Write file
+  tFileHeader header;
+  memcpy(header.magic, cMAGIC, sizeof(cMAGIC));
+  header.version = cVERSION;
+  header.path_count = path_records.size();
+  header.element_offset_count = offset_tables.size();
+  header.hash_index_size = hash_index.size();
+  header.string_pool_size = string_pool.size();
+  header.reserved = 0;
+  // A temporary file is written and then renamed - as truncating a file that is memory-mapped by readers would crash them (SIGBUS)
+  std::string temporary_file_name = file_name + ".tmp";
+  std::ofstream stream(temporary_file_name, std::ios::binary | std::ios::trunc);
+  stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  stream.write(reinterpret_cast<const char*>(path_records.data()), path_records.size() * sizeof(tPathRecord));
+  stream.write(reinterpret_cast<const char*>(offset_tables.data()), offset_tables.size() * sizeof(uint32_t));
+  stream.write(reinterpret_cast<const char*>(hash_index.data()), hash_index.size() * sizeof(uint32_t));
+  stream.write(string_pool.data(), string_pool.size());
+  stream.close();
+  if ((!stream) || std::rename(temporary_file_name.c_str(), file_name.c_str()) != 0)
+  {
+    std::remove(temporary_file_name.c_str());
+    throw std::runtime_error("Could not write path dictionary '" + file_name + "'");
+  }
+}
+
+tPathView tPathDictionary::operator[](size_t index) const
+{
+  const tPathRecord& record = records[index];
+  return tPathView(element_offsets + record.element_offsets, string_pool + record.path_string, record.element_count);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
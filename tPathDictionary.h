@@ -0,0 +1,195 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tPathDictionary.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tPathDictionary
+ *
+ * \b tPathDictionary
+ *
+ * Persistent, memory-mapped set of paths.
+ * Paths are written to a compact file once (see Write() and the rrlib_uri_create_path_dictionary tool).
+ * At runtime, the file is memory-mapped and paths are accessed as tPathViews - without parsing or allocating anything.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__tPathDictionary_h__
+#define __rrlib__uri__tPathDictionary_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tPathView.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Memory-mapped path dictionary
+/*!
+ * Persistent, memory-mapped set of paths.
+ * Opening a dictionary maps the file and validates its header - so startup cost does not depend on the number of paths.
+ * Paths are sorted (by path string) and can be looked up via hash index in O(1) or via binary search in O(log n).
+ *
+ * File layout (native byte order - files are not portable between platforms with different endianness):
+ * - header (magic, version, and section sizes)
+ * - path records (offset of element offset table, offset of path string, element count) - sorted by path string
+ * - element offset tables of all paths (same format as in tPath)
+ * - hash index (open addressing; path indices)
+ * - string pool with all path strings (null-terminated)
+ *
+ * Files are validated when opened (so that invalid files cannot cause out-of-bounds accesses) - this takes time linear in file size.
+ */
+class tPathDictionary
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Returned by Find() if path is not in dictionary */
+  static const size_t cNOT_FOUND = static_cast<size_t>(-1);
+
+  /*!
+   * Memory-maps path dictionary file
+   *
+   * \param file_name Name of file created with Write()
+   * \throws std::runtime_error if file cannot be opened or is no valid path dictionary
+   */
+  explicit tPathDictionary(const std::string& file_name);
+
+  ~tPathDictionary();
+
+  tPathDictionary(const tPathDictionary&) = delete;
+  tPathDictionary& operator=(const tPathDictionary&) = delete;
+
+  /*!
+   * Looks up path using hash index (O(1))
+   *
+   * \param path Path to look for (a tPath can be passed as well)
+   * \return Index of path - or cNOT_FOUND if path is not in dictionary
+   */
+  size_t Find(const tPathView& path) const;
+
+  /*!
+   * Binary search on sorted paths (O(log n))
+   *
+   * \param path Path to look for (a tPath can be passed as well)
+   * \return Index of first path in dictionary that is not less than 'path' (Size() if there is no such path)
+   */
+  size_t LowerBound(const tPathView& path) const;
+
+  /*!
+   * \return Number of paths in dictionary
+   */
+  size_t Size() const
+  {
+    return path_count;
+  }
+
+  /*!
+   * Writes paths to path dictionary file (duplicates are removed).
+   * The file is written to '<file_name>.tmp' first, which is then renamed - so the file can be replaced while it is memory-mapped by other processes.
+   *
+   * \param file_name Name of file to write
+   * \param paths Paths to write
+   * \throws std::runtime_error if file cannot be written
+   * \throws std::invalid_argument if paths exceed the maximum dictionary size (4 GB string pool)
+   */
+  static void Write(const std::string& file_name, const std::vector<tPath>& paths);
+
+  /*!
+   * \param index Path index (in sorted order, < Size())
+   * \return View on path in memory-mapped file (valid as long as this object exists)
+   */
+  tPathView operator[](size_t index) const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  struct tPathRecord;
+
+  /*! Memory-mapped file */
+  void* mapped_memory;
+
+  /*! Size of memory-mapped file */
+  size_t mapped_size;
+
+  /*! Number of paths in dictionary */
+  size_t path_count;
+
+  /*! Path records */
+  const tPathRecord* records;
+
+  /*! Element offset tables */
+  const uint* element_offsets;
+
+  /*! Hash index (size is power of two) */
+  const uint32_t* hash_index;
+
+  /*! Size of hash index */
+  size_t hash_index_size;
+
+  /*! String pool */
+  const char* string_pool;
+
+  /*!
+   * \return Hash of path string (FNV-1a)
+   */
+  static uint32_t Hash(const tPathView& path);
+
+  /*!
+   * \return Whether lhs is sorted before rhs in path dictionaries
+   */
+  static bool Less(const tPathView& lhs, const tPathView& rhs);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
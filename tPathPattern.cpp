@@ -0,0 +1,321 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tPathPattern.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/uri/tPathPattern.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tPathPattern::tPathPattern() :
+  nodes(2),
+  literal_edges(16, tLiteralEdge { cNONE, cNONE, 0, 0, 0 }),
+  literal_edge_count(0),
+  literals(),
+  capture_names()
+{}
+
+void tPathPattern::Activate(tMatchResult& result, uint32_t node, uint32_t capture_log_entry, uint32_t loop_begin, uint32_t position) const
+{
+  if (result.node_step[node] == result.step)
+  {
+    return;
+  }
+  result.node_step[node] = result.step;
+  tMatchResult::tThread thread = { node, capture_log_entry, nodes[node].loop ? loop_begin : position };
+  result.next_threads.push_back(thread);
+
+  // '**' may match zero elements
+  uint32_t closed_capture_log_entry = cNONE;
+  for (const tWildcardEdge & edge : nodes[node].wildcard_edges)
+  {
+    if (edge.multi)
+    {
+      if (closed_capture_log_entry == cNONE)
+      {
+        closed_capture_log_entry = CloseLoopCapture(result, thread, position);
+      }
+      Activate(result, edge.child, closed_capture_log_entry, position, position);
+    }
+  }
+}
+
+size_t tPathPattern::Add(const tPath& pattern)
+{
+  uint32_t node = pattern.IsAbsolute() ? 1 : 0;
+  std::vector<std::string> names;
+  for (auto it = pattern.Begin(); it != pattern.End(); ++it)
+  {
+    const tStringRange& element = *it;
+    const char* chars = element.CharPointer();
+    bool capture = element.Length() >= 2 && chars[0] == '{' && chars[element.Length() - 1] == '}';
+    if (capture || element == "*" || element == "**")
+    {
+      bool multi = capture ? (element.Length() >= 4 && chars[1] == '*' && chars[2] == '*') : element.Length() == 2;
+      uint32_t capture_slot = cNONE;
+      if (capture)
+      {
+        std::string name(chars + (multi ? 3 : 1), element.Length() - (multi ? 4 : 2));
+        if (name.empty())
+        {
+          throw std::invalid_argument("Path pattern contains capture without name");
+        }
+        capture_slot = names.size();
+        names.push_back(name);
+      }
+
+      uint32_t child = cNONE;
+      for (const tWildcardEdge & edge : nodes[node].wildcard_edges)
+      {
+        if (edge.multi == multi && edge.capture_slot == capture_slot)
+        {
+          child = edge.child;
+        }
+      }
+      if (child == cNONE)
+      {
+        child = nodes.size();
+        nodes.emplace_back();
+        nodes.back().loop = multi;
+        nodes.back().loop_capture_slot = multi ? capture_slot : cNONE;
+        nodes[node].wildcard_edges.push_back(tWildcardEdge { child, capture_slot, multi });
+      }
+      node = child;
+    }
+    else
+    {
+      uint32_t hash = Hash(element);
+      uint32_t child = FindLiteralChild(node, hash, element);
+      if (child == cNONE)
+      {
+        // Grow hash table if it is half full
+        if ((literal_edge_count + 1) * 2 > literal_edges.size())
+        {
+          std::vector<tLiteralEdge> old_edges(literal_edges.size() * 2, tLiteralEdge { cNONE, cNONE, 0, 0, 0 });
+          old_edges.swap(literal_edges);
+          for (const tLiteralEdge & edge : old_edges)
+          {
+            if (edge.child != cNONE)
+            {
+              size_t slot = HashTableSlot(edge.parent, edge.hash);
+              while (literal_edges[slot].child != cNONE)
+              {
+                slot = (slot + 1) & (literal_edges.size() - 1);
+              }
+              literal_edges[slot] = edge;
+            }
+          }
+        }
+
+        child = nodes.size();
+        nodes.emplace_back();
+        size_t slot = HashTableSlot(node, hash);
+        while (literal_edges[slot].child != cNONE)
+        {
+          slot = (slot + 1) & (literal_edges.size() - 1);
+        }
+        literal_edges[slot] = tLiteralEdge { node, child, hash, static_cast<uint32_t>(literals.length()), static_cast<uint32_t>(element.Length()) };
+        literals.append(element.CharPointer(), element.Length());
+        literal_edge_count++;
+      }
+      node = child;
+    }
+  }
+
+  size_t id = capture_names.size();
+  nodes[node].pattern_ids.push_back(id);
+  capture_names.push_back(names);
+  return id;
+}
+
+uint32_t tPathPattern::CloseLoopCapture(tMatchResult& result, const tMatchResult::tThread& thread, uint32_t position) const
+{
+  const tNode& node = nodes[thread.node];
+  if (node.loop && node.loop_capture_slot != cNONE)
+  {
+    result.capture_log.push_back(tMatchResult::tCaptureLogEntry { thread.capture_log_entry, node.loop_capture_slot, thread.loop_begin, position });
+    return result.capture_log.size() - 1;
+  }
+  return thread.capture_log_entry;
+}
+
+uint32_t tPathPattern::FindLiteralChild(uint32_t parent, uint32_t element_hash, const tStringRange& element) const
+{
+  size_t slot = HashTableSlot(parent, element_hash);
+  while (literal_edges[slot].child != cNONE)
+  {
+    const tLiteralEdge& edge = literal_edges[slot];
+    if (edge.parent == parent && edge.hash == element_hash && tStringRange(literals.c_str() + edge.literal_offset, edge.literal_length) == element)
+    {
+      return edge.child;
+    }
+    slot = (slot + 1) & (literal_edges.size() - 1);
+  }
+  return cNONE;
+}
+
+uint32_t tPathPattern::Hash(const tStringRange& element)
+{
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < element.Length(); i++)
+  {
+    hash = (hash ^ static_cast<unsigned char>(element.CharPointer()[i])) * 16777619u;
+  }
+  return hash;
+}
+
+bool tPathPattern::Match(const tPath& path, tMatchResult& result) const
+{
+  result.matches.clear();
+  result.captures.clear();
+  result.capture_log.clear();
+  result.next_threads.clear();
+  if (result.node_step.size() < nodes.size())
+  {
+    result.node_step.resize(nodes.size(), cNONE);
+  }
+  if (result.step >= cNONE - path.Size() - 2)
+  {
+    result.step = 0;
+    std::fill(result.node_step.begin(), result.node_step.end(), cNONE);
+  }
+
+  // Run automaton (all active nodes in parallel)
+  result.step++;
+  Activate(result, path.IsAbsolute() ? 1 : 0, cNONE, 0, 0);
+  uint32_t size = path.Size();
+  for (uint32_t position = 0; position < size && result.next_threads.size(); position++)
+  {
+    result.threads.swap(result.next_threads);
+    result.next_threads.clear();
+    result.step++;
+    tStringRange element = path[position];
+    uint32_t hash = Hash(element);
+    for (size_t i = 0; i < result.threads.size(); i++)
+    {
+      tMatchResult::tThread thread = result.threads[i];
+      const tNode& node = nodes[thread.node];
+      uint32_t closed_capture_log_entry = cNONE;
+      bool capture_closed = false;
+
+      uint32_t child = FindLiteralChild(thread.node, hash, element);
+      if (child != cNONE)
+      {
+        closed_capture_log_entry = CloseLoopCapture(result, thread, position);
+        capture_closed = true;
+        Activate(result, child, closed_capture_log_entry, position + 1, position + 1);
+      }
+      for (const tWildcardEdge & edge : node.wildcard_edges)
+      {
+        if (!edge.multi)
+        {
+          if (!capture_closed)
+          {
+            closed_capture_log_entry = CloseLoopCapture(result, thread, position);
+            capture_closed = true;
+          }
+          uint32_t capture_log_entry = closed_capture_log_entry;
+          if (edge.capture_slot != cNONE)
+          {
+            result.capture_log.push_back(tMatchResult::tCaptureLogEntry { capture_log_entry, edge.capture_slot, position, position + 1 });
+            capture_log_entry = result.capture_log.size() - 1;
+          }
+          Activate(result, edge.child, capture_log_entry, position + 1, position + 1);
+        }
+      }
+      if (node.loop)
+      {
+        Activate(result, thread.node, thread.capture_log_entry, thread.loop_begin, position + 1);
+      }
+    }
+  }
+
+  // Collect matches
+  const char* path_end = size ? (path[size - 1].CharPointer() + path[size - 1].Length()) : "";
+  for (const tMatchResult::tThread & thread : result.next_threads)
+  {
+    for (uint32_t pattern_id : nodes[thread.node].pattern_ids)
+    {
+      tMatch match = { pattern_id, result.captures.size(), capture_names[pattern_id].size() };
+      result.captures.resize(match.first_capture + match.capture_count);
+      for (uint32_t entry_index = CloseLoopCapture(result, thread, size); entry_index != cNONE; entry_index = result.capture_log[entry_index].previous)
+      {
+        const tMatchResult::tCaptureLogEntry& entry = result.capture_log[entry_index];
+        if (entry.slot < match.capture_count && (!result.captures[match.first_capture + entry.slot].CharPointer()))
+        {
+          const char* begin = entry.begin < size ? path[entry.begin].CharPointer() : path_end;
+          const char* end = entry.end > entry.begin ? (path[entry.end - 1].CharPointer() + path[entry.end - 1].Length()) : begin;
+          result.captures[match.first_capture + entry.slot] = tStringRange(begin, end - begin);
+        }
+      }
+      result.matches.push_back(match);
+    }
+  }
+  return result.matches.size() > 0;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
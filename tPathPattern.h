@@ -0,0 +1,270 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tPathPattern.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tPathPattern
+ *
+ * \b tPathPattern
+ *
+ * Set of path patterns compiled into one matching automaton.
+ * Allows to efficiently determine which of many patterns match a path.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__tPathPattern_h__
+#define __rrlib__uri__tPathPattern_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <vector>
+#include <cstdint>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tPath.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Path patterns
+/*!
+ * Set of path patterns compiled into one matching automaton (a trie over path elements).
+ * Matching a path returns all matching patterns - in time proportional to path depth (not to the number of patterns).
+ *
+ * Pattern elements can be
+ *  - literal elements - matching identical elements
+ *  - '*' - matching any single element
+ *  - '**' - matching zero or more elements
+ *  - '{name}' - matching any single element, which is captured
+ *  - '{**name}' - matching zero or more elements, which are captured
+ * e.g. "/robot/{name}/Sensor Output/{**port}".
+ * Absolute patterns only match absolute paths - relative patterns only relative paths.
+ * If a pattern matches a path in multiple ways (possible with several '**'), captures of only one of them are returned.
+ */
+class tPathPattern
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Pattern matching a path */
+  struct tMatch
+  {
+    size_t pattern_id;     //!< ID of pattern (as returned by Add())
+    size_t first_capture;  //!< Index of pattern's first capture in tMatchResult::captures
+    size_t capture_count;  //!< Number of captures (in order of occurence in pattern - see GetCaptureNames())
+  };
+
+  /*!
+   * Result of matching a path.
+   * If many paths are matched, it makes sense to reuse the object - as this avoids reallocation of memory.
+   * Captures reference the path's memory - and are only valid as long as the path is not modified.
+   */
+  class tMatchResult
+  {
+  public:
+
+    /*! Matching patterns */
+    std::vector<tMatch> matches;
+
+    /*! Captures of all matches */
+    std::vector<tStringRange> captures;
+
+  private:
+
+    friend class tPathPattern;
+
+    /*! Active automaton threads - in current and next step */
+    struct tThread
+    {
+      uint32_t node;
+      uint32_t capture_log_entry;  //!< Index of last capture of thread in capture log (or cNONE)
+      uint32_t loop_begin;         //!< Index of first element consumed by current '**' node
+    };
+    std::vector<tThread> threads, next_threads;
+
+    /*! Captures of all threads (entries are linked lists) */
+    struct tCaptureLogEntry
+    {
+      uint32_t previous;  //!< Previous capture of same thread (or cNONE)
+      uint32_t slot;      //!< Index of capture in pattern
+      uint32_t begin, end; //!< Captured elements
+    };
+    std::vector<tCaptureLogEntry> capture_log;
+
+    /*! Step in which node was last activated (for each node) */
+    std::vector<uint32_t> node_step;
+
+    /*! Counter for steps (unique across calls to Match(), so that node_step never needs to be reset) */
+    uint32_t step = 0;
+  };
+
+  tPathPattern();
+
+  /*!
+   * Adds pattern to set
+   *
+   * \param pattern Pattern (e.g. /robot/{name}/Sensor Output/{**port})
+   * \return ID of pattern (IDs are assigned consecutively - starting with zero)
+   * \throws std::invalid_argument if pattern contains invalid element (e.g. '{}')
+   */
+  size_t Add(const tPath& pattern);
+
+  /*!
+   * \param pattern_id ID of pattern
+   * \return Names of pattern's captures (in order of occurence in pattern)
+   */
+  const std::vector<std::string>& GetCaptureNames(size_t pattern_id) const
+  {
+    return capture_names[pattern_id];
+  }
+
+  /*!
+   * Matches path against all patterns
+   *
+   * \param path Path to match
+   * \param result Object to store results in (is cleared first)
+   * \return Whether any pattern matches
+   */
+  bool Match(const tPath& path, tMatchResult& result) const;
+
+  /*!
+   * \return Number of patterns in set
+   */
+  size_t Size() const
+  {
+    return capture_names.size();
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  enum { cNONE = 0xFFFFFFFF };
+
+  /*! Transition for wildcard element */
+  struct tWildcardEdge
+  {
+    uint32_t child;         //!< Node that edge leads to
+    uint32_t capture_slot;  //!< Index of capture in pattern (or cNONE)
+    bool multi;             //!< Whether element is '**' - matching zero or more elements
+  };
+
+  /*! Node of automaton */
+  struct tNode
+  {
+    std::vector<tWildcardEdge> wildcard_edges;  //!< Transitions for wildcard elements
+    std::vector<uint32_t> pattern_ids;          //!< Patterns that end at this node
+    bool loop;                                  //!< Whether node consumes any number of elements (is reached via '**')
+    uint32_t loop_capture_slot;                 //!< If loop: Index of capture in pattern (or cNONE)
+
+    tNode() : loop(false), loop_capture_slot(cNONE)
+    {}
+  };
+
+  /*! Transition for literal element (entry in hash table) */
+  struct tLiteralEdge
+  {
+    uint32_t parent, child;  //!< Nodes that edge connects (child is cNONE if entry is empty)
+    uint32_t hash;           //!< Hash of element
+    uint32_t literal_offset; //!< Offset of element in 'literals'
+    uint32_t literal_length; //!< Length of element
+  };
+
+  /*! Nodes of automaton (nodes 0 and 1 are roots for relative and absolute patterns) */
+  std::vector<tNode> nodes;
+
+  /*! Hash table with transitions for literal elements (size is power of two) */
+  std::vector<tLiteralEdge> literal_edges;
+
+  /*! Number of entries in literal_edges */
+  size_t literal_edge_count;
+
+  /*! Characters of all literal elements */
+  std::string literals;
+
+  /*! Capture names of all patterns */
+  std::vector<std::vector<std::string>> capture_names;
+
+  /*!
+   * Activates node in next step (including nodes reachable via '**' without consuming elements)
+   *
+   * \param loop_begin If node is a '**' node: Index of first element consumed by it
+   * \param position Index of next element to consume
+   */
+  void Activate(tMatchResult& result, uint32_t node, uint32_t capture_log_entry, uint32_t loop_begin, uint32_t position) const;
+
+  /*!
+   * Closes capture of '**' node when thread leaves it
+   *
+   * \return Index of thread's last capture in capture log after closing
+   */
+  uint32_t CloseLoopCapture(tMatchResult& result, const tMatchResult::tThread& thread, uint32_t position) const;
+
+  /*!
+   * \return Child node for literal element - or cNONE if there is no such node
+   */
+  uint32_t FindLiteralChild(uint32_t parent, uint32_t element_hash, const tStringRange& element) const;
+
+  /*!
+   * \return Hash of element (FNV-1a)
+   */
+  static uint32_t Hash(const tStringRange& element);
+
+  /*!
+   * \return Slot in literal edge hash table for specified parent and element hash
+   */
+  size_t HashTableSlot(uint32_t parent, uint32_t element_hash) const
+  {
+    return ((element_hash ^ (parent * 0x9E3779B1u)) * 0x85EBCA6Bu) & (literal_edges.size() - 1);
+  }
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,200 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tPathView.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tPathView
+ *
+ * \b tPathView
+ *
+ * Read-only view on a path stored in external memory (e.g. in a tPath, a memory-mapped file, or a shared buffer).
+ * It is only valid as long as this memory is not modified.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__tPathView_h__
+#define __rrlib__uri__tPathView_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tPath.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Path view
+/*!
+ * Read-only view on a path stored in external memory (e.g. in a tPath, a memory-mapped file, or a shared buffer).
+ * Memory layout is the same as in tPath:
+ * - element offset table with (element count + 1) entries: offsets of elements relative to the path string
+ *   (the last entry is the offset after the path string's terminator)
+ * - path string: elements separated with slashes and terminated with zero
+ *
+ * Like tStringRange, it is only valid as long as the referenced memory is not modified.
+ */
+class tPathView
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Creates view on empty path */
+  tPathView() :
+    element_offsets(cEMPTY_OFFSET_TABLE),
+    path_string("\0"),
+    element_count(0)
+  {}
+
+  /*!
+   * \param element_offsets Element offset table (see above)
+   * \param path_string Path string (see above)
+   * \param element_count Number of elements in path
+   */
+  tPathView(const uint* element_offsets, const char* path_string, size_t element_count) :
+    element_offsets(element_offsets),
+    path_string(path_string),
+    element_count(element_count)
+  {}
+
+  /*!
+   * \param path Path to create view on
+   */
+  tPathView(const tPath& path) :
+    element_offsets(path.memory.size() ? path.GetElementOffsetTable() : cEMPTY_OFFSET_TABLE),
+    path_string(path.GetPathStringBegin()),
+    element_count(path.Size())
+  {}
+
+  /*!
+   * \return Whether this is an abolute path
+   */
+  bool IsAbsolute() const
+  {
+    return element_count ? element_offsets[0] == 1 : path_string[0] == '/';
+  }
+
+  /*!
+   * \return Number of elements in path
+   */
+  size_t Size() const
+  {
+    return element_count;
+  }
+
+  /*!
+   * \return Path string - elements separated with slashes (the range is followed by a terminating zero)
+   */
+  tStringRange ToStringRange() const
+  {
+    return element_count ? tStringRange(path_string, element_offsets[element_count] - 1) : tStringRange(path_string, IsAbsolute() ? 1 : 0);
+  }
+
+  /*!
+   * \return Total number of characters in path - including separators and terminator
+   */
+  size_t TotalCharacters() const
+  {
+    return ToStringRange().Length() + 1;
+  }
+
+  tPath::tElement operator[](size_t index) const
+  {
+    return tPath::tElement(path_string + element_offsets[index], element_offsets[index + 1] - element_offsets[index] - 1);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  friend class tPath;
+
+  /*! Offset table for empty paths */
+  static const uint cEMPTY_OFFSET_TABLE[1];
+
+  /*! Element offset table */
+  const uint* element_offsets;
+
+  /*! Path string */
+  const char* path_string;
+
+  /*! Number of elements in path */
+  size_t element_count;
+};
+
+inline bool operator==(const tPathView& lhs, const tPathView& rhs)
+{
+  if (lhs.Size() != rhs.Size() || lhs.IsAbsolute() != rhs.IsAbsolute())
+  {
+    return false;
+  }
+  for (size_t i = 0; i < lhs.Size(); i++)
+  {
+    if (lhs[i] != rhs[i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+inline bool operator!=(const tPathView& lhs, const tPathView& rhs)
+{
+  return !(lhs == rhs);
+}
+
+inline std::ostream& operator << (std::ostream& stream, const tPathView& path) // for command line output
+{
+  stream.write(path.ToStringRange().CharPointer(), path.ToStringRange().Length());
+  return stream;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
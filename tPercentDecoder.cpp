@@ -0,0 +1,137 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tPercentDecoder.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/uri/tPercentDecoder.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+size_t tPercentDecoder::Decode(tStringRange& input, char* output, size_t output_size)
+{
+  const char* input_pointer = input.CharPointer();
+  const char* input_end = input_pointer + input.Length();
+  char* output_pointer = output;
+  char* output_end = output + output_size;
+
+  // Complete percent-encoding from previous chunk
+  if (pending_count)
+  {
+    size_t needed = 3 - pending_count;
+    if (static_cast<size_t>(input_end - input_pointer) < needed)
+    {
+      memcpy(&pending[pending_count], input_pointer, input_end - input_pointer);
+      pending_count += input_end - input_pointer;
+      input = tStringRange(input_end, 0);
+      return 0;
+    }
+    if (output_pointer == output_end)
+    {
+      return 0;
+    }
+    char encoded[3] = { pending[0], pending_count > 1 ? pending[1] : input_pointer[0], input_pointer[needed - 1] };
+    input_pointer += needed;
+    pending_count = 0;
+    output_pointer = tURI::Decode(output_pointer, tStringRange(encoded, 3));
+  }
+
+  while (input_pointer != input_end && output_pointer != output_end)
+  {
+    // Decode as many characters as fit into output - without splitting percent-encodings
+    size_t count = std::min<size_t>(input_end - input_pointer, output_end - output_pointer);
+    size_t safe_count = count;
+    if (input_pointer[count - 1] == '%')
+    {
+      safe_count = count - 1;
+    }
+    else if (count >= 2 && input_pointer[count - 2] == '%')
+    {
+      safe_count = count - 2;
+    }
+    if (safe_count)
+    {
+      output_pointer = tURI::Decode(output_pointer, tStringRange(input_pointer, safe_count));
+      input_pointer += safe_count;
+    }
+    else if (input_end - input_pointer < 3)
+    {
+      // Incomplete percent-encoding at end of chunk
+      pending_count = input_end - input_pointer;
+      memcpy(pending, input_pointer, pending_count);
+      input_pointer = input_end;
+    }
+    else
+    {
+      output_pointer = tURI::Decode(output_pointer, tStringRange(input_pointer, 3));
+      input_pointer += 3;
+    }
+  }
+  input = tStringRange(input_pointer, input_end - input_pointer);
+  return output_pointer - output;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
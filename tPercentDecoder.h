@@ -0,0 +1,137 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tPercentDecoder.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tPercentDecoder
+ *
+ * \b tPercentDecoder
+ *
+ * Stateful percent-decoder that decodes input in chunks to bounded output buffers.
+ * Allows to decode arbitrarily large strings in constant memory.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__tPercentDecoder_h__
+#define __rrlib__uri__tPercentDecoder_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdint>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tURI.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Streaming percent-decoder
+/*!
+ * Stateful percent-decoder that decodes input in chunks to bounded output buffers.
+ * Percent-encodings split across chunk boundaries are carried over to the next chunk.
+ * Allows to decode arbitrarily large strings in constant memory.
+ */
+class tPercentDecoder
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tPercentDecoder() :
+    pending_count(0)
+  {}
+
+  /*!
+   * Decodes next chunk of percent-encoded input.
+   * Percent-encodings that are split across chunks are completed with the next chunk.
+   *
+   * \param input Input chunk. Is updated to the part that has not been consumed (non-empty if output buffer was too small).
+   * \param output Buffer for decoded characters
+   * \param output_size Size of output buffer
+   * \return Number of characters written to output
+   * \throws std::invalid_argument if input contains invalid percent-encoding
+   */
+  size_t Decode(tStringRange& input, char* output, size_t output_size);
+
+  /*!
+   * Completes decoding (no further input)
+   *
+   * \throws std::invalid_argument if input ended with an incomplete percent-encoding
+   */
+  void Finish()
+  {
+    if (pending_count)
+    {
+      pending_count = 0;
+      throw std::invalid_argument("encoded URI string cannot be decoded (incomplete percent-encoding at end)");
+    }
+  }
+
+  /*!
+   * Resets decoder (to decode another string)
+   */
+  void Reset()
+  {
+    pending_count = 0;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Characters of incomplete percent-encoding from previous chunk (including '%') */
+  char pending[2];
+
+  /*! Number of characters in 'pending' */
+  uint8_t pending_count;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
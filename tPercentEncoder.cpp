@@ -0,0 +1,116 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tPercentEncoder.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/uri/tPercentEncoder.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+size_t tPercentEncoder::Encode(tStringRange& input, char* output, size_t output_size)
+{
+  char* output_pointer = output;
+  char* output_end = output + output_size;
+
+  // Write characters that did not fit into previous output buffer
+  size_t pending_written = std::min<size_t>(pending_count, output_size);
+  memcpy(output_pointer, pending, pending_written);
+  output_pointer += pending_written;
+  pending_count -= pending_written;
+  if (pending_count)
+  {
+    memmove(pending, &pending[pending_written], pending_count);
+    return output_pointer - output;
+  }
+
+  // Encode as many characters at once as fit into output buffer in any case
+  const char* input_pointer = input.CharPointer();
+  const char* input_end = input_pointer + input.Length();
+  size_t count = 0;
+  while ((count = std::min<size_t>(input_end - input_pointer, (output_end - output_pointer) / 3)) > 0)
+  {
+    output_pointer = tURI::Encode(output_pointer, tStringRange(input_pointer, count), unencoded_reserved_characters);
+    input_pointer += count;
+  }
+
+  // Fill remaining output buffer character by character
+  while (input_pointer != input_end && output_pointer != output_end)
+  {
+    char encoded[3];
+    size_t encoded_length = tURI::Encode(encoded, tStringRange(input_pointer, 1), unencoded_reserved_characters) - encoded;
+    input_pointer++;
+    size_t fitting = std::min<size_t>(encoded_length, output_end - output_pointer);
+    memcpy(output_pointer, encoded, fitting);
+    output_pointer += fitting;
+    pending_count = encoded_length - fitting;
+    memcpy(pending, &encoded[fitting], pending_count);
+  }
+  input = tStringRange(input_pointer, input_end - input_pointer);
+  return output_pointer - output;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,150 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tPercentEncoder.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tPercentEncoder
+ *
+ * \b tPercentEncoder
+ *
+ * Stateful percent-encoder that encodes input in chunks to bounded output buffers.
+ * Allows to encode arbitrarily large strings in constant memory.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__tPercentEncoder_h__
+#define __rrlib__uri__tPercentEncoder_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdint>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tURI.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Streaming percent-encoder
+/*!
+ * Stateful percent-encoder that encodes input in chunks to bounded output buffers.
+ * Percent-encodings that do not fit into an output buffer are completed in the next one.
+ * Allows to encode arbitrarily large strings in constant memory.
+ */
+class tPercentEncoder
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param unencoded_reserved_characters Reserved characters not to encode (see constants in tURI). String must remain valid as long as encoder is used.
+   */
+  tPercentEncoder(const char* unencoded_reserved_characters) :
+    unencoded_reserved_characters(unencoded_reserved_characters),
+    pending_count(0)
+  {}
+
+  /*!
+   * Encodes next chunk of input.
+   * If output buffer ends within a percent-encoding, the remaining characters are written on the next call.
+   *
+   * \param input Input chunk. Is updated to the part that has not been consumed (non-empty if output buffer was too small).
+   * \param output Buffer for encoded characters
+   * \param output_size Size of output buffer
+   * \return Number of characters written to output
+   */
+  size_t Encode(tStringRange& input, char* output, size_t output_size);
+
+  /*!
+   * Writes characters of percent-encoding that did not fit into previous output buffer
+   * (to be called after last chunk of input - until HasPendingOutput() returns false)
+   *
+   * \param output Buffer for encoded characters
+   * \param output_size Size of output buffer
+   * \return Number of characters written to output
+   */
+  size_t Flush(char* output, size_t output_size)
+  {
+    tStringRange empty;
+    return Encode(empty, output, output_size);
+  }
+
+  /*!
+   * \return Whether there are characters of a percent-encoding that have not been written yet
+   */
+  bool HasPendingOutput() const
+  {
+    return pending_count > 0;
+  }
+
+  /*!
+   * Resets encoder (to encode another string)
+   */
+  void Reset()
+  {
+    pending_count = 0;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Reserved characters not to encode */
+  const char* unencoded_reserved_characters;
+
+  /*! Characters of percent-encoding that did not fit into previous output buffer */
+  char pending[2];
+
+  /*! Number of characters in 'pending' */
+  uint8_t pending_count;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,171 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tQuery.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/uri/tQuery.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/internal/character_classes.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::uri::internal;
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+bool tQuery::EncodedEquals(const tStringRange& encoded, const tStringRange& decoded)
+{
+  const char* encoded_char = encoded.CharPointer();
+  const char* encoded_end = encoded_char + encoded.Length();
+  const char* decoded_char = decoded.CharPointer();
+  const char* decoded_end = decoded_char + decoded.Length();
+  if (encoded.Length() < decoded.Length())
+  {
+    return false;
+  }
+  while (encoded_char != encoded_end)
+  {
+    if (decoded_char == decoded_end)
+    {
+      return false;
+    }
+    char c = *encoded_char;
+    if (c == '%')
+    {
+      if (encoded_end - encoded_char < 3)
+      {
+        return false;
+      }
+      int high = HexValue(encoded_char[1]);
+      int low = HexValue(encoded_char[2]);
+      if (high < 0 || low < 0)
+      {
+        return false;
+      }
+      c = static_cast<char>((high << 4) | low);
+      encoded_char += 3;
+    }
+    else
+    {
+      encoded_char++;
+    }
+    if (c != *decoded_char)
+    {
+      return false;
+    }
+    decoded_char++;
+  }
+  return decoded_char == decoded_end;
+}
+
+tQuery::tConstIterator tQuery::Find(const tStringRange& decoded_key) const
+{
+  for (auto it = Begin(), end = End(); it != end; ++it)
+  {
+    if (EncodedEquals(it->key, decoded_key))
+    {
+      return it;
+    }
+  }
+  return End();
+}
+
+void tQuery::tConstIterator::UpdateParameter()
+{
+  const char* query_end = query->query.CharPointer() + query->query.Length();
+
+  // Skip empty parameters
+  while (position != query_end && query->IsSeparator(*position))
+  {
+    position++;
+  }
+  if (position == query_end)
+  {
+    parameter_end = query_end;
+    parameter = tParameter();
+    return;
+  }
+
+  // Single scan for '=' and the next separator
+  const char* key_end = nullptr;
+  const char* current = position;
+  for (; current != query_end && !query->IsSeparator(*current); current++)
+  {
+    if ((*current) == '=' && (!key_end))
+    {
+      key_end = current;
+    }
+  }
+  parameter_end = current;
+  if (key_end)
+  {
+    parameter.key = tStringRange(position, key_end - position);
+    parameter.value = tStringRange(key_end + 1, current - key_end - 1);
+  }
+  else
+  {
+    parameter.key = tStringRange(position, current - position);
+    parameter.value = tStringRange(current, 0);
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,234 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tQuery.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tQuery
+ *
+ * \b tQuery
+ *
+ * View on the (percent-encoded) query of a URI.
+ * Iterates lazily over the query's key=value parameters.
+ * Like tStringRange, it references the original string - and is only valid as long as this string is not modified.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__tQuery_h__
+#define __rrlib__uri__tQuery_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tURI.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! URI query
+/*!
+ * View on the (percent-encoded) query of a URI.
+ * Iterates lazily over the query's key=value parameters - without allocating any memory.
+ * Keys and values are returned as percent-encoded string ranges and can be decoded to caller buffers on demand.
+ *
+ * Like tStringRange, it references the original string - and is only valid as long as this string is not modified.
+ */
+class tQuery
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  class tConstIterator;
+
+  /*! Query parameter (both ranges are percent-encoded and reference the query string) */
+  struct tParameter
+  {
+    tStringRange key;    //!< Parameter key
+    tStringRange value;  //!< Parameter value (empty if there is no '=' in parameter)
+  };
+
+  /*!
+   * \param query Percent-encoded query (e.g. tURIElements::query)
+   * \param separators Characters that separate parameters (typically "&" or "&;"). String must remain valid as long as this object is used.
+   */
+  tQuery(const tStringRange& query, const char* separators = "&") :
+    query(query),
+    separators(separators)
+  {}
+
+  /*!
+   * \return Begin iterator for query parameters
+   */
+  tConstIterator Begin() const
+  {
+    return tConstIterator(*this, query.CharPointer());
+  }
+
+  /*!
+   * Decodes percent-encoded key or value of a query parameter
+   *
+   * \param decode_buffer Buffer for decoded string. Should have a size >= encoded.Length()
+   * \param encoded Percent-encoded key or value
+   * \return Pointer to character after the last character written in decode_buffer (notably string in decode_buffer is not null-terminated)
+   * \throws std::invalid_argument if string cannot be decoded
+   */
+  static char* Decode(char* decode_buffer, const tStringRange& encoded)
+  {
+    return tURI::Decode(decode_buffer, encoded);
+  }
+
+  /*!
+   * \return End iterator for query parameters
+   */
+  tConstIterator End() const
+  {
+    return tConstIterator(*this, query.CharPointer() + query.Length());
+  }
+
+  /*!
+   * Looks up first parameter with specified key.
+   * Encoded keys in query are compared to the decoded key without decoding them to a buffer.
+   *
+   * \param decoded_key Key to look for (decoded)
+   * \return Iterator pointing to parameter - or End() if there is no such parameter
+   */
+  tConstIterator Find(const tStringRange& decoded_key) const;
+
+  /*!
+   * \param encoded Percent-encoded string
+   * \param decoded Decoded string
+   * \return Whether 'encoded' decodes to 'decoded' (false if 'encoded' contains invalid percent-encoding)
+   */
+  static bool EncodedEquals(const tStringRange& encoded, const tStringRange& decoded);
+
+  /*!
+   * \return Percent-encoded query string
+   */
+  const tStringRange& GetQueryString() const
+  {
+    return query;
+  }
+
+  /*!
+   * Iterator over query parameters
+   */
+  class tConstIterator
+  {
+  public:
+
+    tConstIterator(const tQuery& query, const char* position) :
+      query(&query),
+      position(position),
+      parameter()
+    {
+      UpdateParameter();
+    }
+
+    friend bool operator==(const tConstIterator& lhs, const tConstIterator& rhs)
+    {
+      return lhs.position == rhs.position;
+    }
+    friend bool operator!=(const tConstIterator& lhs, const tConstIterator& rhs)
+    {
+      return !(lhs == rhs);
+    }
+    const tParameter& operator*() const
+    {
+      return parameter;
+    }
+    inline const tParameter* operator->() const
+    {
+      return &(operator*());
+    }
+    inline tConstIterator& operator++()
+    {
+      position = parameter_end;
+      UpdateParameter();
+      return *this;
+    }
+    inline tConstIterator operator ++ (int)
+    {
+      tConstIterator temp(*this);
+      operator++();
+      return temp;
+    }
+
+  private:
+
+    const tQuery* query;
+    const char* position;       //!< Begin of current parameter (or end of query string)
+    const char* parameter_end;  //!< End of current parameter (including separator)
+    tParameter parameter;
+
+    /*! Skips empty parameters and extracts key and value of current one */
+    void UpdateParameter();
+  };
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Percent-encoded query string */
+  tStringRange query;
+
+  /*! Characters that separate parameters */
+  const char* separators;
+
+  /*!
+   * \return Whether character separates parameters
+   */
+  bool IsSeparator(char c) const
+  {
+    return c && strchr(separators, c) != nullptr;
+  }
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,117 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tQueryBuilder.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/uri/tQueryBuilder.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+size_t tQueryBuilder::EncodedLength() const
+{
+  if (parameters.empty())
+  {
+    return 0;
+  }
+  size_t length = 2 * parameters.size() - 1; // '=' and separators
+  for (auto & parameter : parameters)
+  {
+    length += tURI::EncodedLength(parameter.key, tURI::cUNENCODED_RESERVED_CHARACTERS_QUERY_PARAMETER);
+    length += tURI::EncodedLength(parameter.value, tURI::cUNENCODED_RESERVED_CHARACTERS_QUERY_PARAMETER);
+  }
+  return length;
+}
+
+std::string tQueryBuilder::ToString() const
+{
+  std::string result(EncodedLength(), 0);
+  if (result.length())
+  {
+    char* end = Write(&result[0]);
+    assert(end == &result[0] + result.length());
+    (void)end;
+  }
+  return result;
+}
+
+char* tQueryBuilder::Write(char* buffer) const
+{
+  for (size_t i = 0; i < parameters.size(); i++)
+  {
+    if (i > 0)
+    {
+      (*buffer) = separator;
+      buffer++;
+    }
+    buffer = tURI::Encode(buffer, parameters[i].key, tURI::cUNENCODED_RESERVED_CHARACTERS_QUERY_PARAMETER);
+    (*buffer) = '=';
+    buffer++;
+    buffer = tURI::Encode(buffer, parameters[i].value, tURI::cUNENCODED_RESERVED_CHARACTERS_QUERY_PARAMETER);
+  }
+  return buffer;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
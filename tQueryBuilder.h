@@ -0,0 +1,143 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tQueryBuilder.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tQueryBuilder
+ *
+ * \b tQueryBuilder
+ *
+ * Creates percent-encoded URI queries from key/value parameters.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__tQueryBuilder_h__
+#define __rrlib__uri__tQueryBuilder_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tQuery.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Query builder
+/*!
+ * Creates percent-encoded URI queries from (decoded) key/value parameters.
+ * Parameters are only referenced when added - and encoded when the query is written.
+ * The exact length of the encoded query is computed beforehand, so the result is allocated only once.
+ *
+ * As parameters are stored as tStringRanges, the referenced strings must remain valid until the query is written.
+ */
+class tQueryBuilder
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param separator Separator to put between parameters
+   */
+  tQueryBuilder(char separator = '&') :
+    separator(separator)
+  {}
+
+  /*!
+   * Adds parameter to query
+   *
+   * \param key Parameter key (decoded)
+   * \param value Parameter value (decoded)
+   */
+  void Add(const tStringRange& key, const tStringRange& value)
+  {
+    parameters.push_back(tQuery::tParameter { key, value });
+  }
+
+  /*!
+   * Removes all parameters
+   */
+  void Clear()
+  {
+    parameters.clear();
+  }
+
+  /*!
+   * \return Exact length of encoded query (as written by Write())
+   */
+  size_t EncodedLength() const;
+
+  /*!
+   * \return Encoded query (without leading '?')
+   */
+  std::string ToString() const;
+
+  /*!
+   * Writes encoded query to buffer (without leading '?')
+   *
+   * \param buffer Buffer to write query to. Must have a size >= EncodedLength()
+   * \return Pointer to character after the last character written in buffer (notably string in buffer is not null-terminated)
+   */
+  char* Write(char* buffer) const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Separator to put between parameters */
+  char separator;
+
+  /*! Parameters added to query (decoded) */
+  std::vector<tQuery::tParameter> parameters;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,185 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tSchemeRegistry.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/uri/tSchemeRegistry.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tURIElements.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+static const size_t cSCHEME_COUNT = static_cast<size_t>(tSchemeID::DIMENSION);
+
+/*! Scheme names - indexed by scheme ID */
+static constexpr const char* cSCHEME_NAMES[cSCHEME_COUNT] = { "", "http", "https", "ws", "wss", "ftp", "file", "mailto", "urn", "data" };
+
+/*! Information on schemes - indexed by scheme ID */
+static const tSchemeRegistry::tSchemeInfo cSCHEME_INFOS[cSCHEME_COUNT] =
+{
+  { cSCHEME_NAMES[0], 0, nullptr, false },
+  { cSCHEME_NAMES[1], 80, "80", true },
+  { cSCHEME_NAMES[2], 443, "443", true },
+  { cSCHEME_NAMES[3], 80, "80", true },
+  { cSCHEME_NAMES[4], 443, "443", true },
+  { cSCHEME_NAMES[5], 21, "21", true },
+  { cSCHEME_NAMES[6], 0, nullptr, false },
+  { cSCHEME_NAMES[7], 0, nullptr, false },
+  { cSCHEME_NAMES[8], 0, nullptr, false },
+  { cSCHEME_NAMES[9], 0, nullptr, false }
+};
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+constexpr size_t NameLength(const char* name)
+{
+  return *name ? 1 + NameLength(name + 1) : 0;
+}
+
+constexpr unsigned NameHash(size_t scheme_index)
+{
+  return tSchemeRegistry::Hash(cSCHEME_NAMES[scheme_index], NameLength(cSCHEME_NAMES[scheme_index]));
+}
+
+/*! \return Whether hash of scheme 'scheme_index' equals hash of any scheme with index >= 'other_index' */
+constexpr bool HashCollides(size_t scheme_index, size_t other_index)
+{
+  return other_index < cSCHEME_COUNT && (NameHash(scheme_index) == NameHash(other_index) || HashCollides(scheme_index, other_index + 1));
+}
+
+/*! \return Whether hash function is perfect for all schemes with index >= 'scheme_index' */
+constexpr bool IsPerfectHash(size_t scheme_index)
+{
+  return scheme_index >= cSCHEME_COUNT || ((!HashCollides(scheme_index, scheme_index + 1)) && IsPerfectHash(scheme_index + 1));
+}
+
+static_assert(IsPerfectHash(1), "Scheme hash function is not perfect for registered schemes. Adjust tSchemeRegistry::Hash or cHASH_TABLE_SIZE.");
+
+/*! \return Scheme ID whose name has the specified hash (tSchemeID::UNKNOWN if there is no such scheme) */
+constexpr tSchemeID IDWithHash(unsigned hash, size_t scheme_index = 1)
+{
+  return scheme_index >= cSCHEME_COUNT ? tSchemeID::UNKNOWN : (NameHash(scheme_index) == hash ? static_cast<tSchemeID>(scheme_index) : IDWithHash(hash, scheme_index + 1));
+}
+
+#define RRLIB_URI_SCHEME_SLOTS_4(i) IDWithHash(i), IDWithHash(i + 1), IDWithHash(i + 2), IDWithHash(i + 3)
+#define RRLIB_URI_SCHEME_SLOTS_16(i) RRLIB_URI_SCHEME_SLOTS_4(i), RRLIB_URI_SCHEME_SLOTS_4(i + 4), RRLIB_URI_SCHEME_SLOTS_4(i + 8), RRLIB_URI_SCHEME_SLOTS_4(i + 12)
+
+/*! Scheme IDs by hash value (computed at compile time) */
+constexpr tSchemeID cHASH_TABLE[tSchemeRegistry::cHASH_TABLE_SIZE] = { RRLIB_URI_SCHEME_SLOTS_16(0), RRLIB_URI_SCHEME_SLOTS_16(16) };
+static_assert(tSchemeRegistry::cHASH_TABLE_SIZE == 32, "Initializer of cHASH_TABLE needs to be adapted to table size");
+
+#undef RRLIB_URI_SCHEME_SLOTS_16
+#undef RRLIB_URI_SCHEME_SLOTS_4
+
+/*! Parse hooks - indexed by scheme ID */
+std::atomic<tSchemeRegistry::tParseHook> parse_hooks[cSCHEME_COUNT];
+
+}
+
+tSchemeID tSchemeRegistry::GetID(const tStringRange& scheme)
+{
+  size_t length = scheme.Length();
+  if (length == 0)
+  {
+    return tSchemeID::UNKNOWN;
+  }
+  const char* characters = scheme.CharPointer();
+  tSchemeID candidate = cHASH_TABLE[Hash(characters, length)];
+  const char* name = cSCHEME_NAMES[static_cast<size_t>(candidate)];
+  for (size_t i = 0; i < length; i++)
+  {
+    // name[i] is checked first so that comparison stops at the terminator of shorter names (scheme may contain null characters)
+    char c = characters[i];
+    if (name[i] == 0 || ((c >= 'A' && c <= 'Z') ? (c + ('a' - 'A')) : c) != name[i])
+    {
+      return tSchemeID::UNKNOWN;
+    }
+  }
+  return name[length] == 0 ? candidate : tSchemeID::UNKNOWN;
+}
+
+const tSchemeRegistry::tSchemeInfo& tSchemeRegistry::GetInfo(tSchemeID scheme_id)
+{
+  assert(scheme_id < tSchemeID::DIMENSION);
+  return cSCHEME_INFOS[static_cast<size_t>(scheme_id)];
+}
+
+tSchemeRegistry::tParseHook tSchemeRegistry::GetParseHook(tSchemeID scheme_id)
+{
+  return parse_hooks[static_cast<size_t>(scheme_id)].load(std::memory_order_relaxed);
+}
+
+void tSchemeRegistry::SetParseHook(tSchemeID scheme_id, tParseHook hook)
+{
+  if (scheme_id == tSchemeID::UNKNOWN || scheme_id >= tSchemeID::DIMENSION)
+  {
+    throw std::invalid_argument("Parse hooks can only be set for schemes in registry");
+  }
+  parse_hooks[static_cast<size_t>(scheme_id)].store(hook);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,180 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tSchemeRegistry.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tSchemeRegistry
+ *
+ * \b tSchemeRegistry
+ *
+ * Registry of well-known URI schemes with integer IDs, default ports, and optional scheme-specific parse hooks.
+ * Scheme names are mapped to IDs via a perfect hash function that is checked at compile time.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__tSchemeRegistry_h__
+#define __rrlib__uri__tSchemeRegistry_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+class tStringRange;
+struct tURIView;
+struct tURIElements;
+
+/*! IDs of schemes in scheme registry */
+enum class tSchemeID : uint8_t
+{
+  UNKNOWN,  //!< No scheme - or scheme that is not in registry
+  HTTP,
+  HTTPS,
+  WS,
+  WSS,
+  FTP,
+  FILE,
+  MAILTO,
+  URN,
+  DATA,
+  DIMENSION
+};
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Scheme registry
+/*!
+ * Registry of well-known URI schemes.
+ * Allows to dispatch on a URI's scheme with an integer ID instead of comparing strings.
+ *
+ * Scheme names are looked up with a perfect hash function: one hash computation, one table lookup, and one comparison with the candidate's name.
+ * That the hash function is perfect for all registered schemes is checked at compile time (static_assert in tSchemeRegistry.cpp).
+ * Lookup is case-insensitive (as scheme names are - see RFC 3986, section 3.1).
+ */
+class tSchemeRegistry
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * Scheme-specific parser. If set for a scheme, tURI::Parse and tParsedURI::GetElements call it instead of filling tURIElements itself (e.g. to skip decoding opaque paths).
+   * It needs to set all elements of 'result' - apart from scheme_id (which is already set).
+   *
+   * \param view Top-level elements of URI
+   * \param result Object to store results in
+   * \param normalize_path Whether '.' and '..' elements are to be removed from path
+   */
+  typedef void (*tParseHook)(const tURIView& view, tURIElements& result, bool normalize_path);
+
+  /*! Information on scheme in registry */
+  struct tSchemeInfo
+  {
+    const char* name;                 //!< Scheme name (lower case; empty for tSchemeID::UNKNOWN)
+    uint16_t default_port;            //!< Default port (0 if scheme has no default port)
+    const char* default_port_string;  //!< Default port as string (nullptr if scheme has no default port)
+    bool empty_path_is_root;          //!< Whether an empty path is equivalent to "/" (if URI has an authority)
+  };
+
+  /*!
+   * \param scheme_id Scheme ID
+   * \return Default port of scheme (0 if scheme has no default port)
+   */
+  static uint16_t GetDefaultPort(tSchemeID scheme_id)
+  {
+    return GetInfo(scheme_id).default_port;
+  }
+
+  /*!
+   * \param scheme Scheme name (case-insensitive; e.g. tURIElements::scheme)
+   * \return ID of scheme (tSchemeID::UNKNOWN if scheme is not in registry)
+   */
+  static tSchemeID GetID(const tStringRange& scheme);
+
+  /*!
+   * \param scheme_id Scheme ID
+   * \return Information on scheme
+   */
+  static const tSchemeInfo& GetInfo(tSchemeID scheme_id);
+
+  /*!
+   * \param scheme_id Scheme ID
+   * \return Parse hook set for scheme (nullptr if none is set)
+   */
+  static tParseHook GetParseHook(tSchemeID scheme_id);
+
+  /*!
+   * Hash function used for mapping scheme names to IDs.
+   * Only the length and the first and last characters are considered - with the case bit set (so that it is case-insensitive for scheme characters).
+   *
+   * \param name Scheme name
+   * \param length Length of scheme name (> 0)
+   * \return Hash value (< cHASH_TABLE_SIZE)
+   */
+  static constexpr unsigned Hash(const char* name, size_t length)
+  {
+    return (static_cast<unsigned>(length) + static_cast<unsigned char>(name[0] | 0x20) + static_cast<unsigned char>(name[length - 1] | 0x20)) % cHASH_TABLE_SIZE;
+  }
+
+  /*!
+   * Sets scheme-specific parse hook.
+   * Should be set during initialization - before URIs with this scheme are parsed.
+   *
+   * \param scheme_id Scheme ID (not tSchemeID::UNKNOWN)
+   * \param hook Parse hook (nullptr removes hook)
+   */
+  static void SetParseHook(tSchemeID scheme_id, tParseHook hook);
+
+  /*! Size of hash table */
+  static constexpr unsigned cHASH_TABLE_SIZE = 32;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
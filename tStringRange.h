@@ -40,6 +40,9 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -86,6 +89,16 @@ public:
   tStringRange(const std::string& s) : begin_char(s.c_str()), length(s.length())
   {}
 
+#if __cplusplus >= 201703L
+  tStringRange(std::string_view s) : begin_char(s.data()), length(s.length())
+  {}
+
+  operator std::string_view() const
+  {
+    return std::string_view(begin_char, length);
+  }
+#endif
+
   /*!
    * \return Pointer to beginning of string
    */
@@ -32,12 +32,17 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
-#include <regex>
+#include <memory>
 #include <stdexcept>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "rrlib/uri/tURIView.h"
+#include "rrlib/uri/tAuthority.h"
+#include "rrlib/uri/tLazyURIElements.h"
+#include "rrlib/uri/instrumentation.h"
+#include "rrlib/uri/internal/character_classes.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -47,6 +52,7 @@
 //----------------------------------------------------------------------
 // Namespace usage
 //----------------------------------------------------------------------
+using namespace rrlib::uri::internal;
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -60,77 +66,300 @@ namespace uri
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
 
+namespace
+{
+
+/*!
+ * Output of URI normalization.
+ * Writes to buffer containing the original URI - only where characters change.
+ * If WRITE is false, nothing is written and it is merely recorded whether output differs from original.
+ */
+template <bool WRITE>
+struct tNormalizationOutput
+{
+  char* position;
+  bool differs;
+
+  tNormalizationOutput(char* buffer) : position(buffer), differs(false)
+  {}
+
+  void Put(char c)
+  {
+    if ((*position) != c)
+    {
+      differs = true;
+      if (WRITE)
+      {
+        (*position) = c;
+      }
+    }
+    position++;
+  }
+};
+
+}
+
 //----------------------------------------------------------------------
 // Const values
 //----------------------------------------------------------------------
-static std::regex cPARSE_REGEX("^(([^:/?#]+):)?(//([^/?#]*))?([^?#]*)(\\?([^#]*))?(#(.*))?");  // from RFC 3986 Appendix B
 static char cTO_HEX_TABLE[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
 const char* tURI::cUNENCODED_RESERVED_CHARACTERS_PATH = "!$&'()*+,;=:@";
+const char* tURI::cUNENCODED_RESERVED_CHARACTERS_QUERY_PARAMETER = "!$'()*,/:?@";
+
+/*! Paths up to this length are decoded in a stack buffer */
+static const size_t cPATH_DECODE_STACK_BUFFER_SIZE = 512;
 
 
 //----------------------------------------------------------------------
 // Implementation
 //----------------------------------------------------------------------
 
+/*!
+ * Appends string to buffer
+ */
+static inline char* Append(char* buffer, const tStringRange& string)
+{
+  if (string.Length())
+  {
+    memcpy(buffer, string.CharPointer(), string.Length());
+  }
+  return buffer + string.Length();
+}
+
+/*!
+ * \return Whether character is not percent-encoded by tURI::Encode (null characters are encoded - strchr would find the terminator)
+ */
+static inline bool IsUnencoded(char character, const char* unencoded_reserved_characters)
+{
+  return IsUnreserved(character) || (character && strchr(unencoded_reserved_characters, character));
+}
+
+/*!
+ * Characters to write before and after the encoded elements of a path in a URI - so that the URI is parsed to the same path again
+ * (dot-segments in prefixes are removed if the URI is parsed with normalize_path set - see RFC 3986, sections 3.3, 4.2 and 5.3)
+ */
+struct tPathDelimiters
+{
+  /*!
+   * \param path Path to write
+   * \param has_scheme Whether URI has a scheme
+   * \param has_authority Whether URI has an authority
+   * \param unencoded_reserved_characters Reserved characters not encoded in path
+   */
+  tPathDelimiters(const tPath& path, bool has_scheme, bool has_authority, const char* unencoded_reserved_characters) :
+    prefix(""),
+    trailing_slash(path.Size() && path[path.Size() - 1].Length() == 0)  // a single trailing slash is ignored - so one is added for an empty last element
+  {
+    bool empty_first_element = path.Size() && path[0].Length() == 0;
+    if (path.IsAbsolute() || (has_authority && path.Size()))
+    {
+      // Without authority, "//" would start an authority
+      prefix = (empty_first_element && (!has_authority)) ? "/./" : "/";
+    }
+    else if (empty_first_element ||
+             (path.Size() && (!has_scheme) && (!has_authority) && memchr(path[0].CharPointer(), ':', path[0].Length()) && strchr(unencoded_reserved_characters, ':')))
+    {
+      // A relative path must neither start with '/' - nor with an element containing ':' (which would be parsed as scheme)
+      prefix = "./";
+    }
+  }
+
+  /*! Characters to write before first element */
+  const char* prefix;
+
+  /*! Whether to write '/' after last element */
+  bool trailing_slash;
+
+  /*!
+   * \return Number of characters written in addition to the encoded elements (including separators between elements)
+   */
+  size_t Length(const tPath& path) const
+  {
+    return strlen(prefix) + (path.Size() ? path.Size() - 1 : 0) + (trailing_slash ? 1 : 0);
+  }
+};
+
 tURI::tURI(const tPath& path, const char* unencoded_reserved_characters) :
   uri()
 {
-  char buffer[path.TotalCharacters() * 3 + 1];
-  char* buffer_pointer = buffer;
-  if (path.IsAbsolute())
+  tPathDelimiters delimiters(path, false, false, unencoded_reserved_characters);
+  size_t length = delimiters.Length(path);
+  for (size_t i = 0; i < path.Size(); i++)
   {
-    (*buffer_pointer) = '/';
-    buffer_pointer++;
+    length += EncodedLength(path[i], unencoded_reserved_characters);
   }
-  for (size_t i = 0; i < path.Size(); i++)
+  uri.resize(length);
+  if (length)
   {
-    if (i > 0)
+    char* buffer_pointer = Append(&uri[0], delimiters.prefix);
+    for (size_t i = 0; i < path.Size(); i++)
+    {
+      if (i > 0)
+      {
+        (*buffer_pointer) = '/';
+        buffer_pointer++;
+      }
+      buffer_pointer = Encode(buffer_pointer, path[i], unencoded_reserved_characters);
+    }
+    if (delimiters.trailing_slash)
     {
       (*buffer_pointer) = '/';
       buffer_pointer++;
     }
-    buffer_pointer = Encode(buffer_pointer, path[i], unencoded_reserved_characters);
+    assert(buffer_pointer == &uri[0] + length);
+  }
+}
+
+tURI::tURI(const tURIElements& elements) :
+  uri()
+{
+  const tPath& path = elements.path;
+  tPathDelimiters delimiters(path, !elements.scheme.empty(), !elements.authority.empty(), cUNENCODED_RESERVED_CHARACTERS_PATH);
+  size_t path_length = delimiters.Length(path);
+  for (size_t i = 0; i < path.Size(); i++)
+  {
+    path_length += EncodedLength(path[i], cUNENCODED_RESERVED_CHARACTERS_PATH);
+  }
+  size_t length = (elements.scheme.length() ? elements.scheme.length() + 1 : 0) + (elements.authority.length() ? elements.authority.length() + 2 : 0) +
+                  path_length + (elements.query.length() ? elements.query.length() + 1 : 0) + (elements.fragment.length() ? elements.fragment.length() + 1 : 0);
+  uri.resize(length);
+  if (length == 0)
+  {
+    return;
+  }
+
+  char* buffer_pointer = &uri[0];
+  if (elements.scheme.length())
+  {
+    buffer_pointer = Append(buffer_pointer, elements.scheme);
+    (*buffer_pointer++) = ':';
+  }
+  if (elements.authority.length())
+  {
+    (*buffer_pointer++) = '/';
+    (*buffer_pointer++) = '/';
+    buffer_pointer = Append(buffer_pointer, elements.authority);
+  }
+  buffer_pointer = Append(buffer_pointer, delimiters.prefix);
+  for (size_t i = 0; i < path.Size(); i++)
+  {
+    if (i > 0)
+    {
+      (*buffer_pointer++) = '/';
+    }
+    buffer_pointer = Encode(buffer_pointer, path[i], cUNENCODED_RESERVED_CHARACTERS_PATH);
+  }
+  if (delimiters.trailing_slash)
+  {
+    (*buffer_pointer++) = '/';
+  }
+  if (elements.query.length())
+  {
+    (*buffer_pointer++) = '?';
+    buffer_pointer = Append(buffer_pointer, elements.query);
+  }
+  if (elements.fragment.length())
+  {
+    (*buffer_pointer++) = '#';
+    buffer_pointer = Append(buffer_pointer, elements.fragment);
+  }
+  assert(buffer_pointer == &uri[0] + length);
+}
+
+/*!
+ * \return Whether there is a valid percent-encoding at 'percent' (which points to a '%' character)
+ */
+static inline bool IsValidPercentEncoding(const char* percent, const char* end)
+{
+  if (end - percent < 3)
+  {
+    return false;
   }
-  (*buffer_pointer) = 0;
-  uri = buffer;
+  return HexValue(percent[1]) >= 0 && HexValue(percent[2]) >= 0;
 }
 
 char* tURI::Decode(char* decode_buffer, const tStringRange& encoded_string)
 {
-  const char* encoded = encoded_string.CharPointer();
-  for (size_t i = 0; i < encoded_string.Length(); i++)
+  RRLIB_URI_INSTRUMENT(DECODE, encoded_string.Length());
+  const char* current = encoded_string.CharPointer();
+  const char* end = current + encoded_string.Length();
+  while (current != end)
   {
-    if (encoded[i] != '%')
+    // Copy characters up to next '%' in one block (memmove, as decode buffer may be the encoded string)
+    const char* percent = static_cast<const char*>(memchr(current, '%', end - current));
+    size_t count = (percent ? percent : end) - current;
+    if (decode_buffer != current)
     {
-      (*decode_buffer) = encoded[i];
+      memmove(decode_buffer, current, count);
     }
-    else if (i + 2 >= encoded_string.Length())
+    decode_buffer += count;
+    current += count;
+    if (current == end)
     {
-      throw std::invalid_argument("encoded URI string cannot be decoded (invalid percent-encoding)");
+      break;
     }
-    else
+    if (!IsValidPercentEncoding(current, end))
     {
-      char temp[3] = { encoded[i + 1], encoded[i + 2], 0 };
-      char* endptr;
-      char result = static_cast<char>(strtol(temp, &endptr, 16));
-      if (result == 0)
-      {
-        throw std::invalid_argument("encoded URI string cannot be decoded (invalid percent-encoding)");
-      }
-      (*decode_buffer) = result;
-      i += 2;
+      throw std::invalid_argument("encoded URI string cannot be decoded (invalid percent-encoding)");
     }
+    (*decode_buffer) = static_cast<char>((HexValue(current[1]) << 4) | HexValue(current[2]));
     decode_buffer++;
+    current += 3;
   }
   return decode_buffer;
 }
 
+void tURI::Decode(std::string& result, const tStringRange& encoded)
+{
+  size_t offset = result.length();
+  result.resize(offset + DecodedLength(encoded));
+  try
+  {
+    char* decoded_end = Decode(&result[offset], encoded);
+    assert(decoded_end == &result[0] + result.length());
+    (void)decoded_end;
+  }
+  catch (const std::invalid_argument&)
+  {
+    result.resize(offset);
+    throw;
+  }
+}
+
+size_t tURI::DecodedLength(const tStringRange& encoded)
+{
+  // Invalid percent-encodings are counted as single characters - so that Decode() cannot write more characters before it throws
+  const char* current = encoded.CharPointer();
+  const char* end = current + encoded.Length();
+  size_t length = encoded.Length();
+  while (current != end && (current = static_cast<const char*>(memchr(current, '%', end - current))) != nullptr)
+  {
+    bool valid = IsValidPercentEncoding(current, end);
+    length -= valid ? 2 : 0;
+    current += valid ? 3 : 1;
+  }
+  return length;
+}
+
 char* tURI::Encode(char* encode_buffer, const tStringRange& decoded, const char* unencoded_reserved_characters)
 {
-  for (size_t i = 0; i < decoded.Length(); i++)
+  RRLIB_URI_INSTRUMENT(ENCODE, decoded.Length());
+  const char* current = decoded.CharPointer();
+  const char* end = current + decoded.Length();
+  while (current != end)
   {
-    char character = decoded.CharPointer()[i];
-    if (std::isalnum(character) || strchr(unencoded_reserved_characters, character) || character == '_' || character == '.' || character == '-' || character == '~')
+    // Copy unreserved characters in one block (runs are found 16 characters at a time if SSSE3 is available)
+    size_t count = CountLeadingCharacters(current, end - current, cUNRESERVED);
+    memcpy(encode_buffer, current, count);
+    encode_buffer += count;
+    current += count;
+    if (current == end)
+    {
+      break;
+    }
+    char character = *current;
+    current++;
+    if (IsUnencoded(character, unencoded_reserved_characters))
     {
       (*encode_buffer) = character;
       encode_buffer++;
@@ -147,22 +376,790 @@ char* tURI::Encode(char* encode_buffer, const tStringRange& decoded, const char*
   return encode_buffer;
 }
 
-void tURI::Parse(tURIElements& result) const
+void tURI::Encode(std::string& result, const tStringRange& decoded, const char* unencoded_reserved_characters)
+{
+  size_t offset = result.length();
+  result.resize(offset + EncodedLength(decoded, unencoded_reserved_characters));
+  char* encoded_end = Encode(&result[offset], decoded, unencoded_reserved_characters);
+  assert(encoded_end == &result[0] + result.length());
+  (void)encoded_end;
+}
+
+static inline char ToLower(char c)
+{
+  return (c >= 'A' && c <= 'Z') ? (c + ('a' - 'A')) : c;
+}
+
+/*!
+ * Normalizes next (possibly percent-encoded) character in sequence
+ *
+ * \param current Current position in sequence (is advanced to next character)
+ * \param end End of sequence
+ * \param lower_case Whether to convert characters to lower case (e.g. for host)
+ * \param output Buffer to write normalized character to (three characters if it remains percent-encoded)
+ * \return Number of characters written to output
+ */
+static inline size_t NormalizeCharacter(const char*& current, const char* end, bool lower_case, char* output)
+{
+  char c = *current;
+  current++;
+  if (c == '%' && end - current >= 2)
+  {
+    int high_value = HexValue(current[0]), low_value = HexValue(current[1]);
+    if (high_value >= 0 && low_value >= 0)
+    {
+      current += 2;
+      char decoded = static_cast<char>((high_value << 4) | low_value);
+      if (IsUnreserved(decoded))
+      {
+        output[0] = lower_case ? ToLower(decoded) : decoded;
+        return 1;
+      }
+      output[0] = '%';
+      output[1] = cTO_HEX_TABLE[high_value];
+      output[2] = cTO_HEX_TABLE[low_value];
+      return 3;
+    }
+  }
+  output[0] = lower_case ? ToLower(c) : c;
+  return 1;
+}
+
+/*!
+ * Writes normalized version of percent-encoded character sequence to output
+ *
+ * \param lower_case Whether to convert characters to lower case (e.g. for host)
+ */
+template <typename TOutput>
+static void NormalizeCharacters(TOutput& output, const char* begin, const char* end, bool lower_case)
+{
+  for (const char* current = begin; current < end;)
+  {
+    // characters are read before writing - as output might overwrite them
+    char normalized[3];
+    size_t count = NormalizeCharacter(current, end, lower_case, normalized);
+    for (size_t i = 0; i < count; i++)
+    {
+      output.Put(normalized[i]);
+    }
+  }
+}
+
+/*!
+ * Writes path to output - possibly normalizing characters and removing dot-segments (RFC 3986, section 5.2.4)
+ * Segments are normalized first - so that e.g. %2E%2E is also recognized as dot-segment.
+ * Output may be located at the beginning of path (in-place).
+ */
+template <typename TOutput>
+static void NormalizePath(TOutput& output, const tStringRange& path, bool remove_dot_segments, bool normalize_characters = true)
+{
+  const char* current = path.CharPointer();
+  const char* end = current + path.Length();
+  char* path_output_begin = output.position;
+  bool leading_segment = current == end || (*current) != '/'; // segment without preceding '/' in relative paths
+  bool trailing_slash = false;
+  while (current != end)
+  {
+    const char* segment_end = current + (leading_segment ? 0 : 1);
+    while (segment_end != end && (*segment_end) != '/')
+    {
+      segment_end++;
+    }
+    char* segment_output_begin = output.position;
+    if (normalize_characters)
+    {
+      NormalizeCharacters(output, current, segment_end, false);
+    }
+    else
+    {
+      for (const char* c = current; c != segment_end; c++)
+      {
+        output.Put(*c);
+      }
+    }
+    if (remove_dot_segments)
+    {
+      const char* segment = segment_output_begin + (leading_segment ? 0 : 1);
+      size_t segment_length = output.position - segment;
+      bool dot = segment_length == 1 && segment[0] == '.';
+      bool dot_dot = segment_length == 2 && segment[0] == '.' && segment[1] == '.';
+      if (dot || dot_dot)
+      {
+        output.position = segment_output_begin;
+        if (leading_segment)
+        {
+          // skip '/' after leading dot-segment (next segment becomes leading segment)
+          segment_end += (segment_end != end) ? 1 : 0;
+          current = segment_end;
+          continue;
+        }
+        if (dot_dot)
+        {
+          while (output.position != path_output_begin && output.position[-1] != '/')
+          {
+            output.position--;
+          }
+          if (output.position != path_output_begin)
+          {
+            output.position--;
+          }
+        }
+        trailing_slash = true;
+        current = segment_end;
+        continue;
+      }
+    }
+    trailing_slash = false;
+    leading_segment = false;
+    current = segment_end;
+  }
+  if (trailing_slash)
+  {
+    output.Put('/');
+  }
+}
+
+/*!
+ * Locates host in authority: host is located after last '@' and before port
+ */
+static void FindHost(const tStringRange& authority, const char*& host_begin, const char*& host_end)
+{
+  const char* authority_begin = authority.CharPointer();
+  const char* authority_end = authority_begin + authority.Length();
+  host_begin = authority_end;
+  while (host_begin != authority_begin && host_begin[-1] != '@')
+  {
+    host_begin--;
+  }
+  host_end = host_begin;
+  if (host_end != authority_end && (*host_end) == '[')
+  {
+    while (host_end != authority_end && (*host_end) != ']')
+    {
+      host_end++;
+    }
+    host_end += (host_end != authority_end) ? 1 : 0;
+  }
+  else
+  {
+    while (host_end != authority_end && (*host_end) != ':')
+    {
+      host_end++;
+    }
+  }
+}
+
+/*!
+ * Normalizes URI (see tURI::Normalize())
+ *
+ * \param buffer Buffer containing URI string
+ * \param length Length of URI string
+ * \return Pointer to character after last character of normalized URI, whether normalized URI differs from original
+ */
+template <bool WRITE>
+static std::pair<char*, bool> NormalizeURI(char* buffer, size_t length)
+{
+  tURIView view(tStringRange(buffer, length));
+  tNormalizationOutput<WRITE> output(buffer);
+  if (view.HasScheme())
+  {
+    for (size_t i = 0; i < view.scheme.Length(); i++)
+    {
+      output.Put(ToLower(view.scheme.CharPointer()[i]));
+    }
+    output.Put(':');
+  }
+  if (view.has_authority)
+  {
+    output.Put('/');
+    output.Put('/');
+
+    const char* authority_begin = view.authority.CharPointer();
+    const char* authority_end = authority_begin + view.authority.Length();
+    const char* host_begin, *host_end;
+    FindHost(view.authority, host_begin, host_end);
+    NormalizeCharacters(output, authority_begin, host_begin, false);
+    NormalizeCharacters(output, host_begin, host_end, true);
+    NormalizeCharacters(output, host_end, authority_end, false);
+  }
+  NormalizePath(output, view.path, view.HasScheme());
+  if (view.has_query)
+  {
+    output.Put('?');
+    NormalizeCharacters(output, view.query.CharPointer(), view.query.CharPointer() + view.query.Length(), false);
+  }
+  if (view.has_fragment)
+  {
+    output.Put('#');
+    NormalizeCharacters(output, view.fragment.CharPointer(), view.fragment.CharPointer() + view.fragment.Length(), false);
+  }
+  return std::pair<char*, bool>(output.position, output.differs || output.position != buffer + length);
+}
+
+/*!
+ * \return Whether segment is '.' or '..' (possibly percent-encoded)
+ */
+static bool IsDotSegment(const char* begin, const char* end)
 {
-  std::smatch match;
-  std::string empty;
-  if (!std::regex_match(uri, match, cPARSE_REGEX))
+  size_t dots = 0;
+  for (const char* current = begin; current != end; dots++)
   {
-    throw std::invalid_argument("Cannot parse URI " + uri);
+    if (*current == '.')
+    {
+      current++;
+    }
+    else if (end - current >= 3 && current[0] == '%' && current[1] == '2' && (current[2] == 'E' || current[2] == 'e'))
+    {
+      current += 3;
+    }
+    else
+    {
+      return false;
+    }
   }
-  char decoded_buffer[match[5].length() + 1];
-  char* post_decoded = Decode(decoded_buffer, tStringRange(&*match[5].first, match[5].second - match[5].first));
+  return dots == 1 || dots == 2;
+}
+
+namespace
+{
+
+/*!
+ * Produces the characters of a normalized URI one at a time (see tURI::Equivalent()) - without writing the normalized URI to memory.
+ * The URI is split into parts that are either copied or normalized on the fly.
+ */
+class tNormalizedCharacterSource
+{
+public:
+
+  tNormalizedCharacterSource(const tStringRange& uri_string) :
+    part_count(0),
+    current_part(0),
+    pending_count(0),
+    pending_index(0)
+  {
+    tURIView uri(uri_string);
+    const tSchemeRegistry::tSchemeInfo& scheme_info = tSchemeRegistry::GetInfo(tSchemeRegistry::GetID(uri.scheme));
+    const char* default_port = scheme_info.default_port_string;
+    if (uri.HasScheme())
+    {
+      AddPart(uri.scheme, cLOWER_CASE);
+      AddPart(":", cCOPY);
+    }
+    if (uri.has_authority)
+    {
+      const char* authority_end = uri.authority.CharPointer() + uri.authority.Length();
+      const char* host_begin, *host_end;
+      FindHost(uri.authority, host_begin, host_end);
+      AddPart("//", cCOPY);
+      AddPart(tStringRange(uri.authority.CharPointer(), host_begin - uri.authority.CharPointer()), cNORMALIZE);
+      AddPart(tStringRange(host_begin, host_end - host_begin), cLOWER_CASE);
+      if (host_end != authority_end)
+      {
+        // omit empty and default ports (and leading zeros in port numbers)
+        const char* port = host_end + 1;
+        bool digits = true;
+        for (const char* c = port; c != authority_end; c++)
+        {
+          digits &= (*c >= '0' && *c <= '9');
+        }
+        while (digits && authority_end - port > 1 && (*port) == '0')
+        {
+          port++;
+        }
+        tStringRange port_string(port, authority_end - port);
+        if (!(digits && (port_string.Length() == 0 || (default_port && port_string == default_port))))
+        {
+          AddPart(":", cCOPY);
+          AddPart(port_string, digits ? cCOPY : cNORMALIZE);
+        }
+      }
+    }
+
+    bool remove_dot_segments = uri.HasScheme() && HasDotSegments(uri.path);
+    if (scheme_info.empty_path_is_root && uri.has_authority && uri.path.Length() == 0)
+    {
+      AddPart("/", cCOPY);
+    }
+    else if (remove_dot_segments)
+    {
+      // normalize path to buffer
+      char* buffer = path_buffer;
+      if (uri.path.Length() > sizeof(path_buffer))
+      {
+        heap_path_buffer.reset(new char[uri.path.Length()]);
+        buffer = heap_path_buffer.get();
+      }
+      memcpy(buffer, uri.path.CharPointer(), uri.path.Length());
+      tNormalizationOutput<true> output(buffer);
+      NormalizePath(output, tStringRange(buffer, uri.path.Length()), true);
+      AddPart(tStringRange(buffer, output.position - buffer), cCOPY);
+    }
+    else
+    {
+      AddPart(uri.path, cNORMALIZE);
+    }
+
+    if (uri.has_query)
+    {
+      AddPart("?", cCOPY);
+      AddPart(uri.query, cNORMALIZE);
+    }
+    if (uri.has_fragment)
+    {
+      AddPart("#", cCOPY);
+      AddPart(uri.fragment, cNORMALIZE);
+    }
+    position = part_count ? parts[0].begin : nullptr;
+  }
+
+  /*!
+   * \return Next character of normalized URI - or -1 if there are no more characters
+   */
+  int Next()
+  {
+    if (pending_index < pending_count)
+    {
+      return static_cast<unsigned char>(pending[pending_index++]);
+    }
+    while (current_part < part_count)
+    {
+      const tPart& part = parts[current_part];
+      if (position == part.end)
+      {
+        current_part++;
+        position = current_part < part_count ? parts[current_part].begin : nullptr;
+        continue;
+      }
+      if (part.mode == cCOPY)
+      {
+        return static_cast<unsigned char>(*(position++));
+      }
+      pending_count = NormalizeCharacter(position, part.end, part.mode == cLOWER_CASE, pending);
+      pending_index = 1;
+      return static_cast<unsigned char>(pending[0]);
+    }
+    return -1;
+  }
+
+private:
+
+  enum tMode { cCOPY, cNORMALIZE, cLOWER_CASE };
+
+  struct tPart
+  {
+    const char* begin;
+    const char* end;
+    tMode mode;
+  };
+
+  tPart parts[12];
+  size_t part_count, current_part;
+  const char* position;
+  char pending[3];
+  size_t pending_count, pending_index;
+  char path_buffer[256];
+  std::unique_ptr<char[]> heap_path_buffer;
+
+  void AddPart(const tStringRange& range, tMode mode)
+  {
+    assert(part_count < 12);
+    if (range.Length())
+    {
+      parts[part_count] = { range.CharPointer(), range.CharPointer() + range.Length(), mode };
+      part_count++;
+    }
+  }
+
+  static bool HasDotSegments(const tStringRange& path)
+  {
+    const char* end = path.CharPointer() + path.Length();
+    const char* segment_begin = path.CharPointer();
+    for (const char* current = segment_begin; ; current++)
+    {
+      if (current == end || (*current) == '/')
+      {
+        if (IsDotSegment(segment_begin, current))
+        {
+          return true;
+        }
+        if (current == end)
+        {
+          return false;
+        }
+        segment_begin = current + 1;
+      }
+    }
+  }
+};
+
+}
+
+bool tURI::Equivalent(const tStringRange& lhs, const tStringRange& rhs)
+{
+  tNormalizedCharacterSource lhs_source(lhs), rhs_source(rhs);
+  while (true)
+  {
+    int c = lhs_source.Next();
+    if (c != rhs_source.Next())
+    {
+      return false;
+    }
+    if (c < 0)
+    {
+      return true;
+    }
+  }
+}
+
+size_t tURI::EquivalenceHash(const tStringRange& uri)
+{
+  tNormalizedCharacterSource source(uri);
+  uint32_t hash = 2166136261u;
+  for (int c = source.Next(); c >= 0; c = source.Next())
+  {
+    hash = (hash ^ static_cast<uint32_t>(c)) * 16777619u;
+  }
+  return hash;
+}
+
+size_t tURI::EncodedLength(const tStringRange& decoded, const char* unencoded_reserved_characters)
+{
+  const char* current = decoded.CharPointer();
+  const char* end = current + decoded.Length();
+  size_t length = decoded.Length();
+  while (true)
+  {
+    current += CountLeadingCharacters(current, end - current, cUNRESERVED);
+    if (current == end)
+    {
+      return length;
+    }
+    length += IsUnencoded(*current, unencoded_reserved_characters) ? 0 : 2;
+    current++;
+  }
+}
+
+bool tURI::IsNormalized() const
+{
+  return !NormalizeURI<false>(const_cast<char*>(uri.c_str()), uri.length()).second;
+}
+
+void tURI::Normalize()
+{
+  if (uri.length())
+  {
+    auto result = NormalizeURI<true>(&uri[0], uri.length());
+    if (result.second)
+    {
+      uri.resize(result.first - &uri[0]);
+    }
+  }
+}
+
+tURI tURI::Resolve(const tURIView& base, const tStringRange& reference_string)
+{
+  tURI result;
+  Resolve(base, reference_string, result);
+  return result;
+}
+
+void tURI::Resolve(const tURIView& base, const tStringRange& reference_string, tURI& result)
+{
+  tURIView reference(reference_string);
+  const bool use_base_scheme = !reference.HasScheme();
+  const bool use_base_authority = use_base_scheme && (!reference.has_authority);
+  const bool use_base_path = use_base_authority && reference.path.Length() == 0;
+  const bool merge_paths = use_base_authority && reference.path.Length() && reference.path.CharPointer()[0] != '/';
+  const bool use_base_query = use_base_path && (!reference.has_query);
+
+  // Determine components of target URI
+  const tURIView& scheme_source = use_base_scheme ? base : reference;
+  const tURIView& authority_source = use_base_authority ? base : reference;
+  const tURIView& query_source = use_base_query ? base : reference;
+  tStringRange base_path_prefix;  // base path up to last '/' (if paths are merged)
+  if (merge_paths)
+  {
+    const char* base_path_end = base.path.CharPointer() + base.path.Length();
+    const char* last_slash = base_path_end;
+    while (last_slash != base.path.CharPointer() && last_slash[-1] != '/')
+    {
+      last_slash--;
+    }
+    base_path_prefix = tStringRange(base.path.CharPointer(), last_slash - base.path.CharPointer());
+  }
+  const bool add_slash = merge_paths && base.has_authority && base.path.Length() == 0;
+
+  // Size result once (removing dot-segments can only make it shorter)
+  size_t max_length = (scheme_source.HasScheme() ? scheme_source.scheme.Length() + 1 : 0) +
+                      (authority_source.has_authority ? authority_source.authority.Length() + 2 : 0) +
+                      base_path_prefix.Length() + (add_slash ? 1 : 0) + (use_base_path ? base.path.Length() : reference.path.Length()) +
+                      (query_source.has_query ? query_source.query.Length() + 1 : 0) +
+                      (reference.has_fragment ? reference.fragment.Length() + 1 : 0);
+  result.uri.resize(max_length);
+  char* buffer = &result.uri[0];
+  char* position = buffer;
+
+  // Write target URI (RFC 3986, section 5.3)
+  if (scheme_source.HasScheme())
+  {
+    position = Append(position, scheme_source.scheme);
+    (*position++) = ':';
+  }
+  if (authority_source.has_authority)
+  {
+    (*position++) = '/';
+    (*position++) = '/';
+    position = Append(position, authority_source.authority);
+  }
+  if (use_base_path)
+  {
+    position = Append(position, base.path);
+  }
+  else
+  {
+    char* path_begin = position;
+    if (add_slash)
+    {
+      (*position++) = '/';
+    }
+    position = Append(position, base_path_prefix);
+    position = Append(position, reference.path);
+
+    // Remove dot-segments in place
+    tNormalizationOutput<true> output(path_begin);
+    NormalizePath(output, tStringRange(path_begin, position - path_begin), true, false);
+    position = output.position;
+  }
+  if (query_source.has_query)
+  {
+    (*position++) = '?';
+    position = Append(position, query_source.query);
+  }
+  if (reference.has_fragment)
+  {
+    (*position++) = '#';
+    position = Append(position, reference.fragment);
+  }
+  result.uri.resize(position - buffer);
+}
+
+void tURI::DecodePath(const tStringRange& encoded_path, tPath& result, bool normalize)
+{
+  // Decode path to stack buffer - or to heap if path is long (so that long URIs cannot overflow the stack)
+  char stack_buffer[cPATH_DECODE_STACK_BUFFER_SIZE];
+  std::unique_ptr<char[]> heap_buffer(encoded_path.Length() < cPATH_DECODE_STACK_BUFFER_SIZE ? nullptr : new char[encoded_path.Length() + 1]);
+  char* decoded_buffer = heap_buffer ? heap_buffer.get() : stack_buffer;
+  char* post_decoded = Decode(decoded_buffer, encoded_path);
   (*post_decoded) = 0;
-  result.scheme = (match.size() > 2 && match[2].matched) ? match[2] : empty;
-  result.authority = (match.size() > 4 && match[4].matched) ? match[4] : empty;
-  result.path = (match.size() > 5 && match[5].matched) ? tPath(decoded_buffer) : tPath();
-  result.query = (match.size() > 7 && match[7].matched) ? match[7] : empty;
-  result.fragment = (match.size() > 9 && match[9].matched) ? match[9] : empty;
+  result.Set(tStringRange(decoded_buffer, post_decoded - decoded_buffer), '/', normalize);
+}
+
+void tURI::Parse(const tStringRange& uri, tURIElements& result, bool normalize_path)
+{
+  RRLIB_URI_INSTRUMENT(PARSE, uri.Length());
+  tURIView view(uri);
+  RRLIB_URI_INSTRUMENT_ALLOCATIONS((view.path.Length() >= cPATH_DECODE_STACK_BUFFER_SIZE) + (result.scheme.capacity() < view.scheme.Length()) + (result.authority.capacity() < view.authority.Length()) +
+                                   (result.query.capacity() < view.query.Length()) + (result.fragment.capacity() < view.fragment.Length()));
+  result.scheme_id = tSchemeRegistry::GetID(view.scheme);
+  tSchemeRegistry::tParseHook parse_hook = tSchemeRegistry::GetParseHook(result.scheme_id);
+  if (parse_hook)
+  {
+    parse_hook(view, result, normalize_path);
+    return;
+  }
+  DecodePath(view.path, result.path, normalize_path);
+  result.scheme.assign(view.scheme.CharPointer(), view.scheme.Length());
+  result.authority.assign(view.authority.CharPointer(), view.authority.Length());
+  result.query.assign(view.query.CharPointer(), view.query.Length());
+  result.fragment.assign(view.fragment.CharPointer(), view.fragment.Length());
+}
+
+void tURI::Parse(tLazyURIElements& result) const &
+{
+  RRLIB_URI_INSTRUMENT(PARSE, uri.length());
+  result.Set(uri);
+}
+
+/*!
+ * \return First character in [begin, end) that is neither in character class nor part of a valid percent-encoding (end if there is no such character)
+ */
+static const char* FindInvalidCharacter(const char* begin, const char* end, tCharacterClass character_class, bool allow_percent_encoding = true)
+{
+  const char* current = begin;
+  while (true)
+  {
+    current += CountLeadingCharacters(current, end - current, character_class);
+    if (current != end && allow_percent_encoding && (*current) == '%' && end - current >= 3 && IsInClass(current[1], cHEX_DIGIT) && IsInClass(current[2], cHEX_DIGIT))
+    {
+      current += 3;
+      continue;
+    }
+    return current;
+  }
+}
+
+/*!
+ * \return First invalid character in host (end if host is valid)
+ */
+static const char* FindInvalidHostCharacter(const char* begin, const char* end)
+{
+  if (begin == end || (*begin) != '[')
+  {
+    return FindInvalidCharacter(begin, end, cREG_NAME);
+  }
+  if (end - begin < 2 || end[-1] != ']')
+  {
+    return begin;
+  }
+  const char* literal_begin = begin + 1;
+  const char* literal_end = end - 1;
+  if (literal_begin != literal_end && ((*literal_begin) == 'v' || (*literal_begin) == 'V'))
+  {
+    // IPvFuture = "v" 1*HEXDIG "." 1*( unreserved / sub-delims / ":" )
+    const char* version_end = literal_begin + 1 + CountLeadingCharacters(literal_begin + 1, literal_end - literal_begin - 1, cHEX_DIGIT);
+    if (version_end == literal_begin + 1 || version_end == literal_end || (*version_end) != '.')
+    {
+      return version_end;
+    }
+    const char* invalid = FindInvalidCharacter(version_end + 1, literal_end, cUSER_INFO, false);
+    return invalid != literal_end ? invalid : (version_end + 1 == literal_end ? literal_end : end);
+  }
+  uint8_t address[16];
+  return tAuthority::ParseIPv6Address(tStringRange(literal_begin, literal_end - literal_begin), address) ? end : literal_begin;
+}
+
+bool tURI::Validate(const tStringRange& uri, size_t* error_offset)
+{
+  tURIView view(uri);
+  const char* error = nullptr;
+  if (view.HasScheme())
+  {
+    const char* scheme_end = view.scheme.CharPointer() + view.scheme.Length();
+    char first = view.scheme.CharPointer()[0];
+    error = ((first >= 'a' && first <= 'z') || (first >= 'A' && first <= 'Z')) ? FindInvalidCharacter(view.scheme.CharPointer(), scheme_end, cSCHEME, false) : view.scheme.CharPointer();
+    error = error != scheme_end ? error : nullptr;
+  }
+  if ((!error) && view.has_authority)
+  {
+    const char* authority_begin = view.authority.CharPointer();
+    const char* authority_end = authority_begin + view.authority.Length();
+    const char* host_begin, *host_end;
+    FindHost(view.authority, host_begin, host_end);
+    const char* user_info_end = host_begin != authority_begin ? host_begin - 1 : host_begin;
+    error = FindInvalidCharacter(authority_begin, user_info_end, cUSER_INFO);
+    error = error != user_info_end ? error : FindInvalidHostCharacter(host_begin, host_end);
+    if (error == host_end && host_end != authority_end)
+    {
+      error = (*host_end) == ':' ? FindInvalidCharacter(host_end + 1, authority_end, cDIGIT, false) : host_end;
+    }
+    error = error != authority_end ? error : nullptr;
+  }
+  if (!error)
+  {
+    const char* path_end = view.path.CharPointer() + view.path.Length();
+    error = FindInvalidCharacter(view.path.CharPointer(), path_end, cPATH);
+    if ((!view.HasScheme()) && (!view.has_authority))
+    {
+      // first segment of relative-path references must not contain ':' (path-noscheme)
+      for (const char* current = view.path.CharPointer(); current != error && (*current) != '/'; current++)
+      {
+        if ((*current) == ':')
+        {
+          error = current;
+          break;
+        }
+      }
+    }
+    error = error != path_end ? error : nullptr;
+  }
+  if ((!error) && view.has_query)
+  {
+    const char* query_end = view.query.CharPointer() + view.query.Length();
+    error = FindInvalidCharacter(view.query.CharPointer(), query_end, cQUERY);
+    error = error != query_end ? error : nullptr;
+  }
+  if ((!error) && view.has_fragment)
+  {
+    const char* fragment_end = view.fragment.CharPointer() + view.fragment.Length();
+    error = FindInvalidCharacter(view.fragment.CharPointer(), fragment_end, cQUERY);
+    error = error != fragment_end ? error : nullptr;
+  }
+
+  if (error && error_offset)
+  {
+    (*error_offset) = error - uri.CharPointer();
+  }
+  return !error;
+}
+
+void tURI::Write(serialization::tStringOutputStream& stream, const tPath& path, const char* unencoded_reserved_characters)
+{
+  // Encode to small buffer - and flush it to stream whenever it is full
+  const size_t cCHUNK_SIZE = 255;
+  char chunk[cCHUNK_SIZE + 1];
+  tPathDelimiters delimiters(path, false, false, unencoded_reserved_characters);
+  char* chunk_pointer = Append(chunk, delimiters.prefix);
+  for (size_t i = 0; i < path.Size(); i++)
+  {
+    tStringRange element = path[i];
+    if (i > 0)
+    {
+      (*chunk_pointer++) = '/';
+    }
+    for (size_t offset = 0; offset < element.Length();)
+    {
+      size_t characters = std::min<size_t>(element.Length() - offset, (chunk + cCHUNK_SIZE - chunk_pointer) / 3);
+      if (characters == 0)
+      {
+        (*chunk_pointer) = 0;
+        stream << static_cast<const char*>(chunk);
+        chunk_pointer = chunk;
+        continue;
+      }
+      chunk_pointer = Encode(chunk_pointer, tStringRange(element.CharPointer() + offset, characters), unencoded_reserved_characters);
+      offset += characters;
+    }
+    if (chunk + cCHUNK_SIZE - chunk_pointer < 4)
+    {
+      (*chunk_pointer) = 0;
+      stream << static_cast<const char*>(chunk);
+      chunk_pointer = chunk;
+    }
+  }
+  if (delimiters.trailing_slash)
+  {
+    (*chunk_pointer++) = '/';
+  }
+  (*chunk_pointer) = 0;
+  stream << static_cast<const char*>(chunk);
+}
+
+serialization::tOutputStream& operator << (serialization::tOutputStream& stream, const tURI& uri)
+{
+  RRLIB_URI_INSTRUMENT(SERIALIZE, uri.ToString().length());
+  stream << uri.ToString();
+  return stream;
+}
+
+serialization::tInputStream& operator >> (serialization::tInputStream& stream, tURI& uri)
+{
+  RRLIB_URI_INSTRUMENT(DESERIALIZE, 0);
+  stream.ReadString(uri.uri);
+  return stream;
+}
+
+serialization::tStringOutputStream& operator << (serialization::tStringOutputStream& stream, const tURI& uri)
+{
+  RRLIB_URI_INSTRUMENT(SERIALIZE, uri.ToString().length());
+  stream << uri.ToString();
+  return stream;
+}
+
+serialization::tStringInputStream& operator >> (serialization::tStringInputStream& stream, tURI& uri)
+{
+  RRLIB_URI_INSTRUMENT(DESERIALIZE, 0);
+  stream >> uri.uri;
+  return stream;
 }
 
 //----------------------------------------------------------------------
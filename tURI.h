@@ -43,7 +43,7 @@
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
-#include "rrlib/uri/tURIElements.h"
+#include "rrlib/uri/tURIView.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -56,6 +56,7 @@ namespace uri
 //----------------------------------------------------------------------
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
+class tLazyURIElements;
 
 //----------------------------------------------------------------------
 // Class declaration
@@ -72,30 +73,82 @@ class tURI
 //----------------------------------------------------------------------
 public:
 
-  static const char* cUNENCODED_RESERVED_CHARACTERS_PATH;  // !$&'()*+,;=:@
+  static const char* cUNENCODED_RESERVED_CHARACTERS_PATH;             // !$&'()*+,;=:@
+  static const char* cUNENCODED_RESERVED_CHARACTERS_QUERY_PARAMETER;  // !$'()*,/:?@
 
-  /*! URI string */
-  tURI(const std::string uri = std::string()) :
+  /*! URI string (moved if an rvalue is passed) */
+  tURI(std::string uri = std::string()) :
+    uri(std::move(uri))
+  {}
+  tURI(const char* uri) :
     uri(uri)
   {}
+  explicit tURI(const tStringRange& uri) :
+    uri(uri.CharPointer(), uri.Length())
+  {}
 
-  /*! Creates local URI from path */
+  /*!
+   * Creates local URI from path
+   * (the exact length of the encoded URI is computed beforehand - so memory is allocated only once).
+   * So that the URI is parsed to the same path again (with normalize_path set - RFC 3986, sections 3.3, 4.2 and 5.3):
+   * - a relative path whose first element is empty or contains a ':' is prefixed with "./"
+   * - an absolute path whose first element is empty is prefixed with "/." (as "//" would start an authority)
+   * - '/' is appended if the last element is empty (as a single trailing '/' is ignored)
+   */
   tURI(const tPath& path, const char* unencoded_reserved_characters = cUNENCODED_RESERVED_CHARACTERS_PATH);
 
+  /*!
+   * Creates URI from elements
+   * (the exact length of the encoded URI is computed beforehand - so memory is allocated only once).
+   * As tURIElements uses empty strings for elements that are not present, only non-empty elements are added to the URI.
+   * So that the URI is parsed to the same elements again (with normalize_path set - RFC 3986, sections 3.3, 4.2 and 5.3), a relative path is prefixed with '/'
+   * if there is an authority. Without authority, the path is prefixed with "./" or "/." as described for tURI(const tPath&) - the ':' rule only applies if there
+   * is no scheme either.
+   */
+  tURI(const tURIElements& elements);
+
   /*!
    * Converts percent-encoded string to decoded string
    *
-   * \param decode_buffer Buffer for decoded string. As no character could be percent-encoded, should have a size == encoded.Length()
+   * \param decode_buffer Buffer for decoded string. Should have a size >= DecodedLength(encoded) - which is <= encoded.Length().
+   *                      As the decoded string is never longer than the encoded one, this may be encoded.CharPointer() (decoding in place).
    * \param encoded Percent-encoded string
-   * \return Pointer to character after the last character written in decode_buffer (notably string in decode_buffer is not null-terminated)
+   * \return Pointer to character after the last character written in decode_buffer (notably string in decode_buffer is not null-terminated - and may contain null characters encoded as %00)
    * \throws std::invalid_argument if string cannot be decoded
    */
   static char* Decode(char* decode_buffer, const tStringRange& encoded);
 
   /*!
-   * Converts decoded string to percent-encoded string
+   * Appends decoded string to std::string (resizing it exactly once)
    *
-   * \param encode_buffer Buffer for percent-encoded string. As all characters could be percent-encoded, should have a size >= 3 * decoded.Length()
+   * \param result String to append decoded string to (unchanged if string cannot be decoded)
+   * \param encoded Percent-encoded string
+   * \throws std::invalid_argument if string cannot be decoded
+   */
+  static void Decode(std::string& result, const tStringRange& encoded);
+
+  /*!
+   * \param encoded Percent-encoded string
+   * \return Exact number of characters Decode() writes to decode_buffer for this string (if it can be decoded). Never larger than encoded.Length().
+   */
+  static size_t DecodedLength(const tStringRange& encoded);
+
+  /*!
+   * Decodes percent-encoded string in place
+   *
+   * \param string String to decode (contains decoded string afterwards; contents are undefined if string cannot be decoded)
+   * \throws std::invalid_argument if string cannot be decoded
+   */
+  static void DecodeInPlace(std::string& string)
+  {
+    string.resize(Decode(&string[0], string) - &string[0]);
+  }
+
+  /*!
+   * Converts decoded string to percent-encoded string.
+   * Null characters are always encoded (as %00) - so that no null characters are written to URIs.
+   *
+   * \param encode_buffer Buffer for percent-encoded string. Should have a size >= EncodedLength(decoded, unencoded_reserved_characters) - which is <= 3 * decoded.Length()
    * \param decoded String to encode
    * \param unencoded_reserved_characters Reserved characters not to encode (see constants above)
    * \return Pointer to character after the last character written in encode_buffer (notably string in encode_buffer is not null-terminated)
@@ -103,31 +156,217 @@ public:
   static char* Encode(char* encode_buffer, const tStringRange& decoded, const char* unencoded_reserved_characters);
 
   /*!
-   * Parses URI
+   * Appends percent-encoded string to std::string (resizing it exactly once)
+   *
+   * \param result String to append percent-encoded string to
+   * \param decoded String to encode
+   * \param unencoded_reserved_characters Reserved characters not to encode (see constants above)
+   */
+  static void Encode(std::string& result, const tStringRange& decoded, const char* unencoded_reserved_characters);
+
+  /*!
+   * \param decoded String to encode
+   * \param unencoded_reserved_characters Reserved characters not to encode (see constants above)
+   * \return Exact number of characters Encode() writes to encode_buffer for these arguments
+   */
+  static size_t EncodedLength(const tStringRange& decoded, const char* unencoded_reserved_characters);
+
+  /*!
+   * Checks whether two URIs are equivalent:
+   * - syntax-based normalization (as in Normalize()) is applied to both URIs
+   * - for schemes with known default ports (http, https, ws, wss, ftp - see tSchemeRegistry), empty and default ports are omitted
+   *   and an empty path is equivalent to '/' (scheme-based normalization - RFC 3986, section 6.2.3)
+   *
+   * Both URIs are walked in lockstep and normalized on the fly - so normalized URIs are never created.
+   * Memory is only allocated for paths longer than 256 characters that contain dot-segments.
+   *
+   * \param lhs First URI
+   * \param rhs Second URI
+   * \return Whether URIs are equivalent
+   */
+  static bool Equivalent(const tStringRange& lhs, const tStringRange& rhs);
+
+  /*!
+   * \param uri URI
+   * \return Hash of URI that is identical for equivalent URIs (see Equivalent())
+   */
+  static size_t EquivalenceHash(const tStringRange& uri);
+
+  /*!
+   * Equality functor for URI-keyed containers that treat equivalent URIs as equal - e.g.
+   *   std::unordered_map<tURI, T, tURI::tEquivalenceHash, tURI::tEquivalentTo>
+   */
+  struct tEquivalentTo
+  {
+    bool operator()(const tURI& lhs, const tURI& rhs) const
+    {
+      return Equivalent(lhs.uri, rhs.uri);
+    }
+  };
+
+  /*! Hash functor matching tEquivalentTo */
+  struct tEquivalenceHash
+  {
+    size_t operator()(const tURI& uri) const
+    {
+      return EquivalenceHash(uri.uri);
+    }
+  };
+
+  /*!
+   * \return Whether URI is valid (see Validate())
+   */
+  bool IsValid() const
+  {
+    return Validate(uri);
+  }
+
+  /*!
+   * \return Whether URI is normalized (see Normalize())
+   */
+  bool IsNormalized() const;
+
+  /*!
+   * Normalizes URI as specified in RFC 3986, section 6.2.2 (syntax-based normalization) - e.g. to obtain canonical keys for URIs:
+   * - scheme and host are converted to lower case
+   * - hexadecimal digits in percent-encodings are converted to upper case
+   * - percent-encoded unreserved characters are decoded
+   * - dot-segments are removed from path (only if URI has a scheme - as relative references might need them)
+   *
+   * As the normalized URI is never longer than the original one, this is done in a single pass in place.
+   * Characters are only written if they change - so an URI that is already normalized is left untouched.
+   */
+  void Normalize();
+
+  /*!
+   * Parses URI (splitting it as specified in RFC 3986, Appendix B)
+   *
+   * The scheme's ID is looked up in tSchemeRegistry. If a parse hook is set for the scheme, it fills the elements instead.
    *
    * \param result Object to store results in. If many URI are parsed it makes sense to reuse the object - as this avoid reallocation of memory if its fields are sufficiently large.
+   * \param normalize_path Whether to remove '.' and '..' elements from the path (done while the path is split - see tPath::Set())
    * \throw Throws std::invalid_argument if URI could not be parsed
    */
-  void Parse(tURIElements& result) const;
+  void Parse(tURIElements& result, bool normalize_path = false) const
+  {
+    Parse(uri, result, normalize_path);
+  }
+  /*!
+   * \param uri URI string to parse (e.g. a std::string_view)
+   */
+  static void Parse(const tStringRange& uri, tURIElements& result, bool normalize_path = false);
 
   /*!
-   * \return URI string
+   * Splits URI into its elements without decoding the path (it is decoded when first accessed).
+   * The result references this URI's string - and is only valid as long as this URI is not modified.
+   *
+   * \param result Object to store results in
    */
-  const std::string& ToString() const
+  void Parse(tLazyURIElements& result) const &;
+  void Parse(tLazyURIElements& result) const && = delete;  // result would reference the string of a temporary
+
+  /*!
+   * Decodes percent-encoded path (as contained in URIs) to tPath
+   *
+   * \param encoded_path Percent-encoded path
+   * \param result Path to store result in (empty path if encoded path is empty)
+   * \param normalize Whether to remove '.' and '..' elements (see tPath::Set())
+   * \throw Throws std::invalid_argument if path cannot be decoded
+   */
+  static void DecodePath(const tStringRange& encoded_path, tPath& result, bool normalize = false);
+
+  /*!
+   * Resolves URI reference relative to base URI (as specified in RFC 3986, section 5.2 - with strict parser)
+   *
+   * \param base Base URI (should contain a scheme)
+   * \param reference URI reference to resolve (e.g. a relative path such as ../images/logo.png)
+   * \return Target URI
+   */
+  static tURI Resolve(const tURI& base, const tURI& reference)
   {
-    return uri;
+    return Resolve(tURIView(base.uri), reference.uri);
+  }
+  /*!
+   * \param base Base URI that has already been split into its elements
+   */
+  static tURI Resolve(const tURIView& base, const tStringRange& reference);
+  /*!
+   * \param result Object to store target URI in (memory already allocated by its string is reused; base and reference must not reference its string)
+   */
+  static void Resolve(const tURIView& base, const tStringRange& reference, tURI& result);
+
+  /*!
+   * Resolves many URI references relative to the same base URI - e.g.
+   *   tURI::Resolve(base, references.begin(), references.end(), std::back_inserter(targets))
+   * Base URI is only split into its elements once.
+   * References can either be tURI, std::string or const char*.
+   *
+   * \param base Base URI (should contain a scheme)
+   * \param begin URI reference begin iterator
+   * \param end URI reference end iterator
+   * \param destination Output iterator for target URIs
+   */
+  template <typename TReferenceIterator, typename TOutputIterator>
+  static void Resolve(const tURI& base, TReferenceIterator begin, TReferenceIterator end, TOutputIterator destination)
+  {
+    tURIView base_view(base.uri);
+    for (auto it = begin; it != end; ++it)
+    {
+      *destination = Resolve(base_view, GetStringRange(*it));
+      ++destination;
+    }
   }
 
-  friend inline serialization::tInputStream& operator >> (serialization::tInputStream& stream, tURI& uri)
+  /*!
+   * Sets URI string
+   * (a std::string rvalue is moved - otherwise, the string is copied reusing the memory already allocated)
+   *
+   * \param uri URI string
+   */
+  void Set(const tStringRange& uri)
+  {
+    this->uri.assign(uri.CharPointer(), uri.Length());
+  }
+  void Set(const char* uri)
+  {
+    this->uri.assign(uri);
+  }
+  void Set(std::string&& uri)
   {
-    stream.ReadString(uri.uri);
-    return stream;
+    this->uri = std::move(uri);
   }
-  friend inline serialization::tStringInputStream& operator >> (serialization::tStringInputStream& stream, tURI& uri)
+
+  /*!
+   * \return URI string
+   */
+  const std::string& ToString() const
   {
-    stream >> uri.uri;
-    return stream;
+    return uri;
   }
+
+  /*!
+   * Writes local URI created from path directly to string stream (equivalent to stream << tURI(path) - without creating the tURI)
+   *
+   * \param stream Stream to write to
+   * \param path Path to write
+   * \param unencoded_reserved_characters Reserved characters not to encode (see constants above)
+   */
+  static void Write(serialization::tStringOutputStream& stream, const tPath& path, const char* unencoded_reserved_characters = cUNENCODED_RESERVED_CHARACTERS_PATH);
+
+  friend serialization::tInputStream& operator >> (serialization::tInputStream& stream, tURI& uri);
+  friend serialization::tStringInputStream& operator >> (serialization::tStringInputStream& stream, tURI& uri);
+
+  /*!
+   * Validates URI against the grammar of RFC 3986 (URI or relative reference).
+   * Each component is checked for invalid characters and malformed percent-encodings; IP literals are parsed.
+   * No memory is allocated - and long runs of valid characters are scanned 16 at a time if SSSE3 is available.
+   *
+   * \param uri URI string to validate
+   * \param error_offset If not nullptr and URI is invalid, receives offset of the first invalid character
+   * \return Whether URI is valid
+   */
+  static bool Validate(const tStringRange& uri, size_t* error_offset = nullptr);
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
@@ -136,6 +375,23 @@ private:
   /*! URI string */
   std::string uri;
 
+  /*!
+   * \param uri URI to get string range of
+   * \return String range
+   */
+  static tStringRange GetStringRange(const tURI& uri)
+  {
+    return uri.uri;
+  }
+  static tStringRange GetStringRange(const std::string& uri)
+  {
+    return uri;
+  }
+  static tStringRange GetStringRange(const char* uri)
+  {
+    return uri;
+  }
+
 };
 
 inline bool operator==(const tURI& lhs, const tURI& rhs)
@@ -148,17 +404,10 @@ inline bool operator<(const tURI& lhs, const tURI& rhs)
   return lhs.ToString() < rhs.ToString();
 }
 
-inline serialization::tOutputStream& operator << (serialization::tOutputStream& stream, const tURI& uri)
-{
-  stream << uri.ToString();
-  return stream;
-}
-
-inline serialization::tStringOutputStream& operator << (serialization::tStringOutputStream& stream, const tURI& uri)
-{
-  stream << uri.ToString();
-  return stream;
-}
+serialization::tOutputStream& operator << (serialization::tOutputStream& stream, const tURI& uri);
+serialization::tInputStream& operator >> (serialization::tInputStream& stream, tURI& uri);
+serialization::tStringOutputStream& operator << (serialization::tStringOutputStream& stream, const tURI& uri);
+serialization::tStringInputStream& operator >> (serialization::tStringInputStream& stream, tURI& uri);
 
 //----------------------------------------------------------------------
 // End of namespace declaration
@@ -45,6 +45,7 @@
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/uri/tPath.h"
+#include "rrlib/uri/tSchemeRegistry.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -69,12 +70,34 @@ namespace uri
 struct tURIElements
 {
   std::string scheme;    //!< Scheme in URI (empty string if no scheme)
+  tSchemeID scheme_id;   //!< ID of scheme in scheme registry (set by tURI::Parse; tSchemeID::UNKNOWN if scheme is not in registry)
   std::string authority; //!< Authority in URI (percent-encoded; empty string if no authority)
   tPath path;            //!< Path in URI (decoded; empty path if no path)
   std::string query;     //!< Query in URI (percent-encoded; empty string if no query)
   std::string fragment;  //!< Fragment in URI (percent-encoded; empty string if no fragment)
+
+  tURIElements() :
+    scheme_id(tSchemeID::UNKNOWN)
+  {}
 };
 
+inline serialization::tOutputStream& operator << (serialization::tOutputStream& stream, const tURIElements& elements)
+{
+  stream << elements.scheme << elements.authority << elements.path << elements.query << elements.fragment;
+  return stream;
+}
+
+inline serialization::tInputStream& operator >> (serialization::tInputStream& stream, tURIElements& elements)
+{
+  stream.ReadString(elements.scheme);
+  elements.scheme_id = tSchemeRegistry::GetID(elements.scheme);
+  stream.ReadString(elements.authority);
+  stream >> elements.path;
+  stream.ReadString(elements.query);
+  stream.ReadString(elements.fragment);
+  return stream;
+}
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
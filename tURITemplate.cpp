@@ -0,0 +1,372 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tURITemplate.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/uri/tURITemplate.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/internal/character_classes.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::uri::internal;
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! Expansion properties of expression operator (RFC 6570, Appendix A) */
+struct tOperatorProperties
+{
+  char first;           //!< Character to prepend to expansion ('\0' if none)
+  char separator;       //!< Separator between variables
+  bool named;           //!< Whether variable names are added
+  bool empty_equals;    //!< Whether '=' is added for variables with empty values
+  bool allow_reserved;  //!< Whether reserved characters and percent-encoded triplets are passed through
+};
+
+}
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+static const char cTO_HEX_TABLE[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+static const char* cRESERVED_CHARACTERS = ":/?#[]@!$&'()*+,;=";
+static const char* cOPERATORS = "+#./;?&";
+static const char* cRESERVED_OPERATORS = "=,!@|";
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+static tOperatorProperties GetOperatorProperties(char expression_operator)
+{
+  switch (expression_operator)
+  {
+  case '+':
+    return tOperatorProperties { 0, ',', false, false, true };
+  case '#':
+    return tOperatorProperties { '#', ',', false, false, true };
+  case '.':
+    return tOperatorProperties { '.', '.', false, false, false };
+  case '/':
+    return tOperatorProperties { '/', '/', false, false, false };
+  case ';':
+    return tOperatorProperties { ';', ';', true, false, false };
+  case '?':
+    return tOperatorProperties { '?', '&', true, true, false };
+  case '&':
+    return tOperatorProperties { '&', '&', true, true, false };
+  default:
+    return tOperatorProperties { 0, ',', false, false, false };
+  }
+}
+
+/*!
+ * Encodes string (or only counts encoded characters)
+ *
+ * \param buffer Buffer to write to (only used if WRITE is true)
+ * \param allow_reserved Whether reserved characters and percent-encoded triplets are passed through
+ * \return Number of encoded characters
+ */
+template <bool WRITE>
+static size_t EncodeString(char* buffer, const char* string, size_t length, bool allow_reserved)
+{
+  size_t written = 0;
+  for (size_t i = 0; i < length; i++)
+  {
+    char c = string[i];
+    if (IsUnreserved(c) || (allow_reserved && c && strchr(cRESERVED_CHARACTERS, c)))
+    {
+      if (WRITE)
+      {
+        buffer[written] = c;
+      }
+      written++;
+    }
+    else if (allow_reserved && c == '%' && i + 2 < length && IsInClass(string[i + 1], cHEX_DIGIT) && IsInClass(string[i + 2], cHEX_DIGIT))
+    {
+      if (WRITE)
+      {
+        memcpy(&buffer[written], &string[i], 3);
+      }
+      written += 3;
+      i += 2;
+    }
+    else
+    {
+      if (WRITE)
+      {
+        unsigned char value = static_cast<unsigned char>(c);
+        buffer[written] = '%';
+        buffer[written + 1] = cTO_HEX_TABLE[value >> 4];
+        buffer[written + 2] = cTO_HEX_TABLE[value & 0xF];
+      }
+      written += 3;
+    }
+  }
+  return written;
+}
+
+/*!
+ * \return Length of first 'max_characters' (UTF-8) characters in value in bytes
+ */
+static size_t PrefixLength(const tStringRange& value, uint32_t max_characters)
+{
+  if (max_characters == 0)
+  {
+    return value.Length();
+  }
+  uint32_t characters = 0;
+  for (size_t i = 0; i < value.Length(); i++)
+  {
+    if ((static_cast<unsigned char>(value.CharPointer()[i]) & 0xC0) != 0x80)  // not a continuation byte
+    {
+      if (characters == max_characters)
+      {
+        return i;
+      }
+      characters++;
+    }
+  }
+  return value.Length();
+}
+
+tURITemplate::tURITemplate(const tStringRange& uri_template)
+{
+  const char* current = uri_template.CharPointer();
+  const char* end = current + uri_template.Length();
+  while (current != end)
+  {
+    if ((*current) != '{')
+    {
+      // Literal (encode characters that are not allowed in URIs)
+      const char* literal_end = static_cast<const char*>(memchr(current, '{', end - current));
+      literal_end = literal_end ? literal_end : end;
+      size_t literal_length = EncodeString<false>(nullptr, current, literal_end - current, true);
+      size_t offset = literals.length();
+      literals.resize(offset + literal_length);
+      EncodeString<true>(&literals[offset], current, literal_end - current, true);
+      operations.push_back(tOperation { 'L', static_cast<uint32_t>(offset), static_cast<uint32_t>(literal_length) });
+      current = literal_end;
+      continue;
+    }
+
+    // Expression
+    const char* expression_end = static_cast<const char*>(memchr(current, '}', end - current));
+    if (!expression_end)
+    {
+      throw std::invalid_argument("Malformed URI template (unclosed expression)");
+    }
+    current++;
+    char expression_operator = 0;
+    if (current != expression_end && strchr(cRESERVED_OPERATORS, *current))
+    {
+      throw std::invalid_argument("Malformed URI template (reserved expression operator)");
+    }
+    if (current != expression_end && strchr(cOPERATORS, *current))
+    {
+      expression_operator = *current;
+      current++;
+    }
+    tOperation operation = { expression_operator, static_cast<uint32_t>(variable_references.size()), 0 };
+    while (true)
+    {
+      // Variable name: varchar *( ["."] varchar )
+      const char* name_begin = current;
+      while (current != expression_end && (*current) != ',' && (*current) != ':' && (*current) != '*')
+      {
+        char c = *current;
+        bool valid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || (c == '.' && current != name_begin && current[-1] != '.') ||
+                     (c == '%' && expression_end - current > 2 && IsInClass(current[1], cHEX_DIGIT) && IsInClass(current[2], cHEX_DIGIT));
+        if (!valid)
+        {
+          throw std::invalid_argument("Malformed URI template (invalid variable name)");
+        }
+        current += (c == '%') ? 3 : 1;
+      }
+      if (current == name_begin || current[-1] == '.')
+      {
+        throw std::invalid_argument("Malformed URI template (invalid variable name)");
+      }
+      std::string name(name_begin, current);
+      tVariableReference reference = { static_cast<uint32_t>(std::find(variable_names.begin(), variable_names.end(), name) - variable_names.begin()), 0 };
+      if (reference.variable_index == variable_names.size())
+      {
+        variable_names.push_back(name);
+      }
+
+      // Modifiers
+      if (current != expression_end && (*current) == ':')
+      {
+        current++;
+        const char* digits_begin = current;
+        while (current != expression_end && (*current) >= '0' && (*current) <= '9' && current - digits_begin < 4)
+        {
+          reference.max_length = reference.max_length * 10 + ((*current) - '0');
+          current++;
+        }
+        if (reference.max_length == 0)
+        {
+          throw std::invalid_argument("Malformed URI template (invalid prefix modifier)");
+        }
+      }
+      else if (current != expression_end && (*current) == '*')
+      {
+        current++;
+      }
+      variable_references.push_back(reference);
+      operation.count++;
+
+      if (current == expression_end)
+      {
+        break;
+      }
+      if ((*current) != ',')
+      {
+        throw std::invalid_argument("Malformed URI template (invalid variable specification)");
+      }
+      current++;
+    }
+    operations.push_back(operation);
+    current = expression_end + 1;
+  }
+}
+
+template <bool WRITE>
+size_t tURITemplate::Expand(char* buffer, const std::vector<tStringRange>& values) const
+{
+  assert(values.size() == variable_names.size());
+  size_t written = 0;
+  for (const tOperation & operation : operations)
+  {
+    if (operation.expression_operator == 'L')
+    {
+      if (WRITE)
+      {
+        memcpy(&buffer[written], &literals[operation.first], operation.count);
+      }
+      written += operation.count;
+      continue;
+    }
+
+    tOperatorProperties properties = GetOperatorProperties(operation.expression_operator);
+    bool first = true;
+    for (uint32_t i = operation.first; i < operation.first + operation.count; i++)
+    {
+      const tVariableReference& reference = variable_references[i];
+      const tStringRange& value = values[reference.variable_index];
+      if (!value.CharPointer())
+      {
+        continue; // undefined
+      }
+      char prefix = first ? properties.first : properties.separator;
+      if (prefix)
+      {
+        if (WRITE)
+        {
+          buffer[written] = prefix;
+        }
+        written++;
+      }
+      first = false;
+      if (properties.named)
+      {
+        const std::string& name = variable_names[reference.variable_index];
+        if (WRITE)
+        {
+          memcpy(&buffer[written], name.c_str(), name.length());
+        }
+        written += name.length();
+        if (value.Length() == 0 && (!properties.empty_equals))
+        {
+          continue;
+        }
+        if (WRITE)
+        {
+          buffer[written] = '=';
+        }
+        written++;
+      }
+      written += EncodeString<WRITE>(WRITE ? &buffer[written] : nullptr, value.CharPointer(), PrefixLength(value, reference.max_length), properties.allow_reserved);
+    }
+  }
+  return written;
+}
+
+tURI tURITemplate::Expand(const std::vector<tStringRange>& values) const
+{
+  std::string result(Expand<false>(nullptr, values), 0);
+  if (result.length())
+  {
+    Expand<true>(&result[0], values);
+  }
+  return tURI(std::move(result));
+}
+
+char* tURITemplate::Expand(char* buffer, const std::vector<tStringRange>& values) const
+{
+  return buffer + Expand<true>(buffer, values);
+}
+
+size_t tURITemplate::ExpandedLength(const std::vector<tStringRange>& values) const
+{
+  return Expand<false>(nullptr, values);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
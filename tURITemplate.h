@@ -0,0 +1,170 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tURITemplate.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tURITemplate
+ *
+ * \b tURITemplate
+ *
+ * Precompiled URI template as specified in RFC 6570.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__tURITemplate_h__
+#define __rrlib__uri__tURITemplate_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <vector>
+#include <cstdint>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tURI.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! URI template
+/*!
+ * Precompiled URI template as specified in RFC 6570 (e.g. "http://{host}/robots{/robot,port}{?format}").
+ * All expression operators (levels 1 to 3) and prefix modifiers are supported - for variables with string values.
+ * (the explode modifier is accepted; as it only affects list and map values, it has no effect).
+ *
+ * The template is compiled once into a sequence of literal and expansion operations.
+ * Expansion computes the exact length of the result first - and encodes all variables in one pass into a single buffer.
+ * Variables are identified by index (in order of first occurence in template - see GetVariableNames()).
+ */
+class tURITemplate
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param uri_template URI template to compile
+   * \throws std::invalid_argument if template is malformed
+   */
+  tURITemplate(const tStringRange& uri_template);
+
+  /*!
+   * Expands template
+   *
+   * \param values Variable values (decoded; in order of GetVariableNames()). Undefined variables are represented by tStringRange() - with null char pointer.
+   * \return Expanded URI
+   */
+  tURI Expand(const std::vector<tStringRange>& values) const;
+
+  /*!
+   * Expands template to buffer
+   *
+   * \param buffer Buffer for expanded URI. Must have a size >= ExpandedLength(values)
+   * \param values Variable values (see above)
+   * \return Pointer to character after the last character written in buffer (notably string in buffer is not null-terminated)
+   */
+  char* Expand(char* buffer, const std::vector<tStringRange>& values) const;
+
+  /*!
+   * \param values Variable values (see above)
+   * \return Exact length of expanded URI
+   */
+  size_t ExpandedLength(const std::vector<tStringRange>& values) const;
+
+  /*!
+   * \return Names of variables in template (in order of first occurence in template)
+   */
+  const std::vector<std::string>& GetVariableNames() const
+  {
+    return variable_names;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Operation of compiled template */
+  struct tOperation
+  {
+    char expression_operator;  //!< Expression operator ('\0' for simple expressions); 'L' for literal
+    uint32_t first;            //!< Literal: offset in 'literals'; Expression: index of first variable reference
+    uint32_t count;            //!< Literal: length; Expression: number of variable references
+  };
+
+  /*! Reference to variable in expression */
+  struct tVariableReference
+  {
+    uint32_t variable_index;  //!< Index of variable
+    uint32_t max_length;      //!< Prefix modifier: maximum number of characters (0 if no prefix modifier)
+  };
+
+  /*! Operations of compiled template */
+  std::vector<tOperation> operations;
+
+  /*! Variable references of all expressions */
+  std::vector<tVariableReference> variable_references;
+
+  /*! Literals (already percent-encoded) */
+  std::string literals;
+
+  /*! Variable names */
+  std::vector<std::string> variable_names;
+
+  /*!
+   * Expands template - or computes length of expanded template
+   *
+   * \param buffer Buffer to write to (only used if WRITE is true)
+   * \param values Variable values
+   * \return Length of expanded template
+   */
+  template <bool WRITE>
+  size_t Expand(char* buffer, const std::vector<tStringRange>& values) const;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,142 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tURIView.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/uri/tURIView.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+void tURIView::Set(const tStringRange& uri)
+{
+  const char* current = uri.CharPointer();
+  const char* end = current + uri.Length();
+
+  // Scheme: ^(([^:/?#]+):)?
+  const char* element_begin = current;
+  while (current != end && (*current) != ':' && (*current) != '/' && (*current) != '?' && (*current) != '#')
+  {
+    current++;
+  }
+  if (current != end && (*current) == ':' && current != element_begin)
+  {
+    scheme = tStringRange(element_begin, current - element_begin);
+    current++;
+  }
+  else
+  {
+    scheme = tStringRange(element_begin, 0);
+    current = element_begin;
+  }
+
+  // Authority: (//([^/?#]*))?
+  has_authority = end - current >= 2 && current[0] == '/' && current[1] == '/';
+  if (has_authority)
+  {
+    current += 2;
+    element_begin = current;
+    while (current != end && (*current) != '/' && (*current) != '?' && (*current) != '#')
+    {
+      current++;
+    }
+    authority = tStringRange(element_begin, current - element_begin);
+  }
+  else
+  {
+    authority = tStringRange(current, 0);
+  }
+
+  // Path: ([^?#]*)
+  element_begin = current;
+  while (current != end && (*current) != '?' && (*current) != '#')
+  {
+    current++;
+  }
+  path = tStringRange(element_begin, current - element_begin);
+
+  // Query: (\?([^#]*))?
+  has_query = current != end && (*current) == '?';
+  if (has_query)
+  {
+    current++;
+    element_begin = current;
+    while (current != end && (*current) != '#')
+    {
+      current++;
+    }
+    query = tStringRange(element_begin, current - element_begin);
+  }
+  else
+  {
+    query = tStringRange(current, 0);
+  }
+
+  // Fragment: (#(.*))?
+  has_fragment = current != end && (*current) == '#';
+  fragment = has_fragment ? tStringRange(current + 1, end - current - 1) : tStringRange(current, 0);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,121 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tURIView.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tURIView
+ *
+ * \b tURIView
+ *
+ * Top-level elements of a URI as string ranges referencing the URI string.
+ * Like tStringRange, it is only valid as long as the URI string is not modified.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__uri__tURIView_h__
+#define __rrlib__uri__tURIView_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tURIElements.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! URI view
+/*!
+ * Top-level elements of a URI as string ranges referencing the URI string (all percent-encoded).
+ * In contrast to tURIElements, obtaining them does not allocate or copy any memory.
+ * The URI is split as specified in RFC 3986, Appendix B.
+ *
+ * Like tStringRange, it is only valid as long as the URI string is not modified.
+ */
+struct tURIView
+{
+  tStringRange scheme;     //!< Scheme in URI (empty range if no scheme)
+  tStringRange authority;  //!< Authority in URI (empty range if no authority)
+  tStringRange path;       //!< Path in URI (empty range if no path)
+  tStringRange query;      //!< Query in URI (empty range if no query)
+  tStringRange fragment;   //!< Fragment in URI (empty range if no fragment)
+  bool has_authority;      //!< Whether URI contains an authority (possibly empty - as in "file:///")
+  bool has_query;          //!< Whether URI contains a query (possibly empty - as in "http://host/?")
+  bool has_fragment;       //!< Whether URI contains a fragment (possibly empty - as in "http://host/#")
+
+  tURIView() :
+    has_authority(false),
+    has_query(false),
+    has_fragment(false)
+  {}
+
+  /*!
+   * \param uri URI string to split
+   */
+  tURIView(const tStringRange& uri) :
+    tURIView()
+  {
+    Set(uri);
+  }
+
+  /*!
+   * \return Whether URI contains a scheme
+   */
+  bool HasScheme() const
+  {
+    return scheme.Length() > 0;
+  }
+
+  /*!
+   * Splits URI string into its top-level elements
+   *
+   * \param uri URI string to split
+   */
+  void Set(const tStringRange& uri);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,1739 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tests/test_uri.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * Unit tests for the uri library.
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "rrlib/util/tUnitTestSuite.h"
+#include "rrlib/serialization/serialization.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tURI.h"
+#include "rrlib/uri/tAuthority.h"
+#include "rrlib/uri/tQuery.h"
+#include "rrlib/uri/tQueryBuilder.h"
+#include "rrlib/uri/tPathPattern.h"
+#include "rrlib/uri/tURITemplate.h"
+#include "rrlib/uri/tIRI.h"
+#include "rrlib/uri/tLazyURIElements.h"
+#include "rrlib/uri/tParsedURI.h"
+#include "rrlib/uri/tSchemeRegistry.h"
+#include "rrlib/uri/tPercentEncoder.h"
+#include "rrlib/uri/tPercentDecoder.h"
+#include "rrlib/uri/tPathBatch.h"
+#include "rrlib/uri/tPathDictionary.h"
+#include "rrlib/uri/instrumentation.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace uri
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * \return Copy of string range as std::string (e.g. for comparisons in tests)
+ */
+static std::string ToString(const tStringRange& string_range)
+{
+  return std::string(string_range.CharPointer(), string_range.Length());
+}
+
+class TestPath : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestPath);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestSet);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestSetManyElements);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestSerialization);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  /*!
+   * Checks that path_string is split into the expected elements
+   */
+  void CheckSet(const std::string& path_string, bool normalize, bool absolute, const std::vector<std::string>& elements)
+  {
+    tPath path;
+    path.Set(path_string, '/', normalize);
+    std::string message = "Path: '" + path_string + (normalize ? "' (normalized)" : "'");
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(message, absolute, path.IsAbsolute());
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(message, elements.size(), path.Size());
+    for (size_t i = 0; i < elements.size(); i++)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(message, elements[i], ToString(path[i]));
+    }
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE(message, path == tPath(path_string, '/', normalize));
+  }
+
+  void TestSet()
+  {
+    for (bool normalize : { false, true })
+    {
+      CheckSet("", normalize, false, {});
+      CheckSet("/", normalize, true, {});
+      CheckSet("a", normalize, false, { "a" });
+      CheckSet("a/", normalize, false, { "a" });
+      CheckSet("a//", normalize, false, { "a", "" });
+      CheckSet("//", normalize, true, { "" });
+      CheckSet("///", normalize, true, { "", "" });
+      CheckSet("/a/b/", normalize, true, { "a", "b" });
+    }
+    CheckSet("/..", false, true, { ".." });
+    CheckSet("/..", true, true, {});
+    CheckSet("a/b/../../..", false, false, { "a", "b", "..", "..", ".." });
+    CheckSet("a/b/../../..", true, false, {});
+    CheckSet("/a/./b/../c/.", true, true, { "a", "c" });
+    CheckSet("a/.../..b/.", true, false, { "a", "...", "..b" });
+
+    // Separators other than '/' are replaced
+    tPath path;
+    path.Set("\\x\\y", '\\');
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("/x/y"), path.ToString());
+  }
+
+  void TestSetManyElements()
+  {
+    // More elements than fit in Set()'s stack buffer
+    for (size_t element_count : { 127, 128, 129, 1000 })
+    {
+      std::string path_string;
+      std::vector<std::string> elements;
+      for (size_t i = 0; i < element_count; i++)
+      {
+        elements.push_back("e" + std::to_string(i));
+        path_string += "/" + elements.back();
+      }
+      CheckSet(path_string, false, true, elements);
+      CheckSet(path_string + "/x/..", true, true, elements);
+      CheckSet(path_string + "/.", false, true, [&]()
+      {
+        std::vector<std::string> result = elements;
+        result.push_back(".");
+        return result;
+      }());
+    }
+  }
+
+  void TestSerialization()
+  {
+    const std::vector<std::string> elements = { "a/b", "" };
+    std::vector<tPath> paths = { tPath(), tPath("/"), tPath("a"), tPath("/a/b"), tPath("//"), tPath("a//"), tPath("/x/%/y/", '/', true), tPath(false, elements.begin(), elements.end()) };
+    std::string long_path;
+    for (size_t i = 0; i < 300; i++)
+    {
+      long_path += "/element" + std::to_string(i);
+    }
+    paths.push_back(tPath(long_path));
+
+    serialization::tMemoryBuffer buffer;
+    serialization::tOutputStream output(buffer);
+    for (const tPath & path : paths)
+    {
+      output << path;
+    }
+    output.Close();
+    serialization::tInputStream input(buffer);
+    for (const tPath & path : paths)
+    {
+      tPath deserialized("/previous/content");
+      input >> deserialized;
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE("Path: '" + path.ToString() + "'", path == deserialized);
+      RRLIB_UNIT_TESTS_EQUALITY(path.Size(), deserialized.Size());
+      RRLIB_UNIT_TESTS_EQUALITY(path.IsAbsolute(), deserialized.IsAbsolute());
+    }
+  }
+};
+
+class TestResolve : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestResolve);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestNormalExamples);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestAbnormalExamples);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void CheckResolve(const char* reference, const char* expected_target)
+  {
+    const tURI base("http://a/b/c/d;p?q");
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(std::string("Reference: '") + reference + "'", std::string(expected_target), tURI::Resolve(base, reference).ToString());
+    tURI target("previous");
+    tURI::Resolve(tURIView(base.ToString()), reference, target);
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(std::string("Reference: '") + reference + "'", std::string(expected_target), target.ToString());
+  }
+
+  /*! RFC 3986, section 5.4.1 */
+  void TestNormalExamples()
+  {
+    CheckResolve("g:h", "g:h");
+    CheckResolve("g", "http://a/b/c/g");
+    CheckResolve("./g", "http://a/b/c/g");
+    CheckResolve("g/", "http://a/b/c/g/");
+    CheckResolve("/g", "http://a/g");
+    CheckResolve("//g", "http://g");
+    CheckResolve("?y", "http://a/b/c/d;p?y");
+    CheckResolve("g?y", "http://a/b/c/g?y");
+    CheckResolve("#s", "http://a/b/c/d;p?q#s");
+    CheckResolve("g#s", "http://a/b/c/g#s");
+    CheckResolve("g?y#s", "http://a/b/c/g?y#s");
+    CheckResolve(";x", "http://a/b/c/;x");
+    CheckResolve("g;x", "http://a/b/c/g;x");
+    CheckResolve("g;x?y#s", "http://a/b/c/g;x?y#s");
+    CheckResolve("", "http://a/b/c/d;p?q");
+    CheckResolve(".", "http://a/b/c/");
+    CheckResolve("./", "http://a/b/c/");
+    CheckResolve("..", "http://a/b/");
+    CheckResolve("../", "http://a/b/");
+    CheckResolve("../g", "http://a/b/g");
+    CheckResolve("../..", "http://a/");
+    CheckResolve("../../", "http://a/");
+    CheckResolve("../../g", "http://a/g");
+  }
+
+  /*! RFC 3986, section 5.4.2 (with strict parser) */
+  void TestAbnormalExamples()
+  {
+    CheckResolve("../../../g", "http://a/g");
+    CheckResolve("../../../../g", "http://a/g");
+    CheckResolve("/./g", "http://a/g");
+    CheckResolve("/../g", "http://a/g");
+    CheckResolve("g.", "http://a/b/c/g.");
+    CheckResolve(".g", "http://a/b/c/.g");
+    CheckResolve("g..", "http://a/b/c/g..");
+    CheckResolve("..g", "http://a/b/c/..g");
+    CheckResolve("./../g", "http://a/b/g");
+    CheckResolve("./g/.", "http://a/b/c/g/");
+    CheckResolve("g/./h", "http://a/b/c/g/h");
+    CheckResolve("g/../h", "http://a/b/c/h");
+    CheckResolve("g;x=1/./y", "http://a/b/c/g;x=1/y");
+    CheckResolve("g;x=1/../y", "http://a/b/c/y");
+    CheckResolve("g?y/./x", "http://a/b/c/g?y/./x");
+    CheckResolve("g?y/../x", "http://a/b/c/g?y/../x");
+    CheckResolve("g#s/./x", "http://a/b/c/g#s/./x");
+    CheckResolve("g#s/../x", "http://a/b/c/g#s/../x");
+    CheckResolve("http:g", "http:g");
+  }
+};
+
+class TestQuery : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestQuery);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestIterator);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestBuilder);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestNullCharacters);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void TestIterator()
+  {
+    tQuery query("a=1&&b=x%20y&c&k%3Dx=v;a=2", "&;");
+    std::vector<std::string> keys, values;
+    for (auto it = query.Begin(); it != query.End(); ++it)
+    {
+      keys.push_back(ToString(it->key));
+      values.push_back(ToString(it->value));
+    }
+    RRLIB_UNIT_TESTS_ASSERT(keys == std::vector<std::string>({ "a", "b", "c", "k%3Dx", "a" }));
+    RRLIB_UNIT_TESTS_ASSERT(values == std::vector<std::string>({ "1", "x%20y", "", "v", "2" }));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("v"), ToString(query.Find("k=x")->value));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("1"), ToString(query.Find("a")->value));
+    RRLIB_UNIT_TESTS_ASSERT(query.Find("x") == query.End());
+    RRLIB_UNIT_TESTS_ASSERT(tQuery("").Begin() == tQuery("").End());
+
+    RRLIB_UNIT_TESTS_ASSERT(tQuery::EncodedEquals("x%20y", "x y"));
+    RRLIB_UNIT_TESTS_ASSERT(!tQuery::EncodedEquals("x%20y", "x%20y"));
+    RRLIB_UNIT_TESTS_ASSERT(!tQuery::EncodedEquals("x%2", "x"));
+  }
+
+  void TestBuilder()
+  {
+    tQueryBuilder builder;
+    builder.Add("k y", "a&b=c");
+    builder.Add("n", "/?:@");
+    std::string query = builder.ToString();
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("k%20y=a%26b%3Dc&n=/?:@"), query);
+    RRLIB_UNIT_TESTS_EQUALITY(query.length(), builder.EncodedLength());
+    tQuery parsed(query);
+    RRLIB_UNIT_TESTS_ASSERT(tQuery::EncodedEquals(parsed.Find("k y")->value, "a&b=c"));
+
+    builder.Clear();
+    RRLIB_UNIT_TESTS_EQUALITY(std::string(), builder.ToString());
+  }
+
+  void TestNullCharacters()
+  {
+    // Null characters are encoded - and can be decoded again
+    const std::string decoded("a\0b", 3);
+    for (const char* unencoded_reserved_characters : { tURI::cUNENCODED_RESERVED_CHARACTERS_PATH, tURI::cUNENCODED_RESERVED_CHARACTERS_QUERY_PARAMETER })
+    {
+      std::string encoded;
+      tURI::Encode(encoded, decoded, unencoded_reserved_characters);
+      RRLIB_UNIT_TESTS_EQUALITY(std::string("a%00b"), encoded);
+      RRLIB_UNIT_TESTS_EQUALITY(encoded.length(), tURI::EncodedLength(decoded, unencoded_reserved_characters));
+      RRLIB_UNIT_TESTS_EQUALITY(decoded.length(), tURI::DecodedLength(encoded));
+      std::string decoded_again;
+      tURI::Decode(decoded_again, encoded);
+      RRLIB_UNIT_TESTS_EQUALITY(decoded, decoded_again);
+      RRLIB_UNIT_TESTS_ASSERT(tQuery::EncodedEquals(encoded, decoded));
+    }
+
+    tQueryBuilder builder;
+    builder.Add(decoded, decoded);
+    std::string query = builder.ToString();
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("a%00b=a%00b"), query);
+    RRLIB_UNIT_TESTS_ASSERT(tURI::Validate("http://h/?" + query));
+    tQuery parsed(query);
+    RRLIB_UNIT_TESTS_ASSERT(parsed.Find(decoded) != parsed.End());
+  }
+};
+
+class TestAuthority : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestAuthority);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestSplit);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestIPAddresses);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestMalformed);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void TestSplit()
+  {
+    tAuthority authority("user:pw@example.com:8080");
+    RRLIB_UNIT_TESTS_ASSERT(authority.HasUserInfo() && authority.HasPort());
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("user:pw"), ToString(authority.GetUserInfo()));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("example.com"), ToString(authority.GetHost()));
+    RRLIB_UNIT_TESTS_ASSERT(authority.GetHostType() == tAuthority::tHostType::REGISTERED_NAME);
+    RRLIB_UNIT_TESTS_EQUALITY(8080, authority.GetPort());
+
+    authority.Set("@host:");
+    RRLIB_UNIT_TESTS_ASSERT(authority.HasUserInfo() && authority.GetUserInfo().Length() == 0);
+    RRLIB_UNIT_TESTS_ASSERT(!authority.HasPort());
+    RRLIB_UNIT_TESTS_EQUALITY(443, authority.GetPort(443));
+
+    authority.Set("");
+    RRLIB_UNIT_TESTS_ASSERT(!authority.HasUserInfo() && authority.GetHost().Length() == 0);
+  }
+
+  void TestIPAddresses()
+  {
+    tAuthority authority("192.168.0.1:80");
+    RRLIB_UNIT_TESTS_ASSERT(authority.GetHostType() == tAuthority::tHostType::IPV4_ADDRESS);
+    const uint8_t ipv4[4] = { 192, 168, 0, 1 };
+    RRLIB_UNIT_TESTS_ASSERT(memcmp(authority.GetIPAddress(), ipv4, 4) == 0);
+
+    authority.Set("[2001:db8::7]:8443");
+    RRLIB_UNIT_TESTS_ASSERT(authority.GetHostType() == tAuthority::tHostType::IPV6_ADDRESS);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("2001:db8::7"), ToString(authority.GetHost()));
+    const uint8_t ipv6[16] = { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7 };
+    RRLIB_UNIT_TESTS_ASSERT(memcmp(authority.GetIPAddress(), ipv6, 16) == 0);
+    RRLIB_UNIT_TESTS_EQUALITY(8443, authority.GetPort());
+
+    uint8_t address[16];
+    const uint8_t mapped[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff, 192, 168, 0, 1 };
+    RRLIB_UNIT_TESTS_ASSERT(tAuthority::ParseIPv6Address("::ffff:192.168.0.1", address) && memcmp(address, mapped, 16) == 0);
+    RRLIB_UNIT_TESTS_ASSERT(!tAuthority::ParseIPv6Address("1::2::3", address));
+    RRLIB_UNIT_TESTS_ASSERT(!tAuthority::ParseIPv4Address("256.0.0.1", address));
+    RRLIB_UNIT_TESTS_ASSERT(!tAuthority::ParseIPv4Address("1.2.3", address));
+
+    authority.Set("[v1.fe]");
+    RRLIB_UNIT_TESTS_ASSERT(authority.GetHostType() == tAuthority::tHostType::IP_FUTURE);
+
+    // Dotted-decimal names that are no valid IPv4 addresses are registered names
+    authority.Set("1.2.3.999");
+    RRLIB_UNIT_TESTS_ASSERT(authority.GetHostType() == tAuthority::tHostType::REGISTERED_NAME);
+  }
+
+  void TestMalformed()
+  {
+    for (const char* authority : { "host:65536", "host:8x", "[::1", "[1::2::3]", "[192.168.0.1]" })
+    {
+      bool thrown = false;
+      try
+      {
+        tAuthority parsed(authority);
+      }
+      catch (const std::invalid_argument&)
+      {
+        thrown = true;
+      }
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE(std::string("Authority: ") + authority, thrown);
+    }
+  }
+};
+
+class TestNormalize : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestNormalize);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestSyntaxBasedNormalization);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void CheckNormalize(const char* uri_string, const char* expected)
+  {
+    tURI uri(uri_string);
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(std::string("URI: ") + uri_string, strcmp(uri_string, expected) == 0, uri.IsNormalized());
+    uri.Normalize();
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(std::string("URI: ") + uri_string, std::string(expected), uri.ToString());
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE(std::string("URI: ") + uri_string, uri.IsNormalized());
+  }
+
+  /*! RFC 3986, section 6.2.2 */
+  void TestSyntaxBasedNormalization()
+  {
+    CheckNormalize("HTTP://User@Example.COM:80/a/./b/../c/%7euser/%2fx%3a?Q=%7E%aa#Frag%2e", "http://User@example.com:80/a/c/~user/%2Fx%3A?Q=~%AA#Frag.");
+    CheckNormalize("http://example.com/a/b", "http://example.com/a/b");
+    CheckNormalize("http://example.com/a/b/..", "http://example.com/a/");
+    CheckNormalize("http://example.com/../../a", "http://example.com/a");
+    CheckNormalize("http://example.com/a/%2E%2E/b", "http://example.com/b");
+    CheckNormalize("http://[FE80::A]:8080/", "http://[fe80::a]:8080/");
+    CheckNormalize("http://h/.", "http://h/");
+
+    // Relative references keep their dot-segments; invalid percent-encodings are left untouched
+    CheckNormalize("../a/./b", "../a/./b");
+    CheckNormalize("http://h/%zz%4", "http://h/%zz%4");
+    CheckNormalize("", "");
+  }
+};
+
+class TestURIConstruction : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestURIConstruction);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestFromPath);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestFromElements);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  /*!
+   * \return Paths with elements that are difficult to represent in URIs
+   */
+  static std::vector<tPath> GetPaths()
+  {
+    std::vector<tPath> result;
+    for (bool absolute : { false, true })
+    {
+      for (const std::vector<std::string>& elements : std::vector<std::vector<std::string>>(
+    {
+      {}, { "" }, { "", "" }, { "", "a" }, { "a", "" }, { "a", "", "b" }, { "a:b" }, { "a:b", "c" }, { "a b", "%", "?#" }
+    }))
+      {
+        result.emplace_back(absolute, elements.begin(), elements.end());
+      }
+    }
+    return result;
+  }
+
+  void TestFromPath()
+  {
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("/.//a"), tURI(tPath("//a")).ToString());
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("/.//"), tURI(tPath("//")).ToString());
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("./a:b"), tURI(tPath("a:b")).ToString());
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("/a/b"), tURI(tPath("/a/b/")).ToString());
+
+    for (const tPath & path : GetPaths())
+    {
+      tURI uri(path);
+      std::string message = "URI: " + uri.ToString();
+      tURIElements elements;
+      uri.Parse(elements, true);
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE(message, elements.scheme.empty() && elements.authority.empty());
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE(message, elements.path == path);
+
+      serialization::tStringOutputStream stream;
+      tURI::Write(stream, path);
+      RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(message, uri.ToString(), stream.ToString());
+    }
+  }
+
+  void TestFromElements()
+  {
+    for (const char* scheme : { "", "file" })
+    {
+      for (const char* authority : { "", "host" })
+      {
+        for (const tPath & path : GetPaths())
+        {
+          tURIElements elements;
+          elements.scheme = scheme;
+          elements.authority = authority;
+          elements.path = path;
+          elements.query = "q";
+          tURI uri(elements);
+          std::string message = "URI: " + uri.ToString();
+          tURIElements parsed;
+          uri.Parse(parsed, true);
+          RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(message, elements.scheme, parsed.scheme);
+          RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(message, elements.authority, parsed.authority);
+          RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(message, elements.query, parsed.query);
+          if (authority[0] && (!path.IsAbsolute()) && path.Size())
+          {
+            // Relative paths become absolute if there is an authority (RFC 3986, section 3.3)
+            RRLIB_UNIT_TESTS_ASSERT_MESSAGE(message, parsed.path == path.MakeAbsolute());
+          }
+          else
+          {
+            RRLIB_UNIT_TESTS_ASSERT_MESSAGE(message, parsed.path == path);
+          }
+        }
+      }
+    }
+
+    tURIElements elements;
+    elements.path = tPath("//x");
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("/.//x"), tURI(elements).ToString());
+    elements.authority = "h";
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("//h//x"), tURI(elements).ToString());
+  }
+};
+
+class TestPathPattern : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestPathPattern);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestMatch);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestCaptures);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestInvalidPatterns);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  /*!
+   * \return IDs of patterns that match path (in ascending order)
+   */
+  static std::vector<size_t> Match(const tPathPattern& patterns, const char* path)
+  {
+    tPathPattern::tMatchResult result;
+    patterns.Match(tPath(path), result);
+    std::vector<size_t> ids;
+    for (const tPathPattern::tMatch & match : result.matches)
+    {
+      ids.push_back(match.pattern_id);
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+  void TestMatch()
+  {
+    tPathPattern patterns;
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(0), patterns.Add(tPath("/robot/*/Sensor Output/**")));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(1), patterns.Add(tPath("/robot/arm/Sensor Output/Force")));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), patterns.Add(tPath("/**")));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(3), patterns.Add(tPath("robot/*")));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(4), patterns.Add(tPath("/**/Force")));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(5), patterns.Size());
+
+    RRLIB_UNIT_TESTS_ASSERT(Match(patterns, "/robot/arm/Sensor Output/Force") == std::vector<size_t>({ 0, 1, 2, 4 }));
+    RRLIB_UNIT_TESTS_ASSERT(Match(patterns, "/robot/leg/Sensor Output") == std::vector<size_t>({ 0, 2 }));
+    RRLIB_UNIT_TESTS_ASSERT(Match(patterns, "/robot/leg/Sensor Output/a/b/c") == std::vector<size_t>({ 0, 2 }));
+    RRLIB_UNIT_TESTS_ASSERT(Match(patterns, "/robot/Sensor Output/Force") == std::vector<size_t>({ 2, 4 }));
+    RRLIB_UNIT_TESTS_ASSERT(Match(patterns, "/Force") == std::vector<size_t>({ 2, 4 }));
+    RRLIB_UNIT_TESTS_ASSERT(Match(patterns, "/") == std::vector<size_t>({ 2 }));
+
+    // Absolute patterns only match absolute paths - relative patterns only relative paths
+    RRLIB_UNIT_TESTS_ASSERT(Match(patterns, "robot/arm") == std::vector<size_t>({ 3 }));
+    RRLIB_UNIT_TESTS_ASSERT(Match(patterns, "robot/arm/x").empty());
+    RRLIB_UNIT_TESTS_ASSERT(Match(patterns, "/robot/arm") == std::vector<size_t>({ 2 }));
+
+    tPathPattern::tMatchResult result;
+    RRLIB_UNIT_TESTS_ASSERT(!patterns.Match(tPath("Force/x"), result));
+    RRLIB_UNIT_TESTS_ASSERT(result.matches.empty() && result.captures.empty());
+  }
+
+  void TestCaptures()
+  {
+    tPathPattern patterns;
+    patterns.Add(tPath("/robot/{name}/Sensor Output/{**port}"));
+    patterns.Add(tPath("/{first}/**"));
+    RRLIB_UNIT_TESTS_ASSERT(patterns.GetCaptureNames(0) == std::vector<std::string>({ "name", "port" }));
+
+    tPath path("/robot/arm/Sensor Output/Force/x");
+    tPathPattern::tMatchResult result;
+    RRLIB_UNIT_TESTS_ASSERT(patterns.Match(path, result));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), result.matches.size());
+    for (const tPathPattern::tMatch & match : result.matches)
+    {
+      if (match.pattern_id == 0)
+      {
+        RRLIB_UNIT_TESTS_EQUALITY(size_t(2), match.capture_count);
+        RRLIB_UNIT_TESTS_EQUALITY(std::string("arm"), ToString(result.captures[match.first_capture]));
+        RRLIB_UNIT_TESTS_EQUALITY(std::string("Force/x"), ToString(result.captures[match.first_capture + 1]));
+      }
+      else
+      {
+        RRLIB_UNIT_TESTS_EQUALITY(size_t(1), match.capture_count);
+        RRLIB_UNIT_TESTS_EQUALITY(std::string("robot"), ToString(result.captures[match.first_capture]));
+      }
+    }
+
+    // '{**name}' may capture zero elements
+    RRLIB_UNIT_TESTS_ASSERT(patterns.Match(tPath("/robot/arm/Sensor Output"), result));
+    for (const tPathPattern::tMatch & match : result.matches)
+    {
+      if (match.pattern_id == 0)
+      {
+        RRLIB_UNIT_TESTS_EQUALITY(std::string(""), ToString(result.captures[match.first_capture + 1]));
+      }
+    }
+  }
+
+  void TestInvalidPatterns()
+  {
+    tPathPattern patterns;
+    for (const char* pattern : { "/{}", "/a/{**}" })
+    {
+      try
+      {
+        patterns.Add(tPath(pattern));
+        RRLIB_UNIT_TESTS_ASSERT_MESSAGE(std::string("No exception for ") + pattern, false);
+      }
+      catch (const std::invalid_argument&)
+      {}
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(0), patterns.Size());
+
+    // Elements that only contain braces are literals
+    patterns.Add(tPath("/a{b}"));
+    RRLIB_UNIT_TESTS_ASSERT(Match(patterns, "/a{b}") == std::vector<size_t>({ 0 }));
+    RRLIB_UNIT_TESTS_ASSERT(Match(patterns, "/ab").empty());
+  }
+};
+
+class TestURITemplate : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestURITemplate);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestExpansion);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestMalformedTemplates);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  /*!
+   * Expands template with variables from RFC 6570, section 3.2 - and checks result
+   */
+  void CheckExpand(const char* uri_template, const char* expected)
+  {
+    static const std::vector<std::pair<std::string, std::string>> cVARIABLES =
+    {
+      { "var", "value" }, { "hello", "Hello World!" }, { "path", "/foo/bar" }, { "x", "1024" }, { "y", "768" }, { "empty", "" }
+    };
+    tURITemplate compiled(uri_template);
+    std::vector<tStringRange> values;
+    for (const std::string & name : compiled.GetVariableNames())
+    {
+      auto variable = std::find_if(cVARIABLES.begin(), cVARIABLES.end(), [&name](const std::pair<std::string, std::string>& v)
+      {
+        return v.first == name;
+      });
+      values.push_back(variable == cVARIABLES.end() ? tStringRange() : tStringRange(variable->second));
+    }
+    size_t length = compiled.ExpandedLength(values);
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(uri_template, std::string(expected), compiled.Expand(values).ToString());
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(uri_template, strlen(expected), length);
+    std::vector<char> buffer(length + 1, '#');
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE(uri_template, compiled.Expand(buffer.data(), values) == buffer.data() + length && buffer[length] == '#');
+  }
+
+  void TestExpansion()
+  {
+    // Examples from RFC 6570, section 1.2 (levels 1 to 3)
+    CheckExpand("{var}", "value");
+    CheckExpand("{hello}", "Hello%20World%21");
+    CheckExpand("{+var}", "value");
+    CheckExpand("{+hello}", "Hello%20World!");
+    CheckExpand("{+path}/here", "/foo/bar/here");
+    CheckExpand("here?ref={+path}", "here?ref=/foo/bar");
+    CheckExpand("X{#var}", "X#value");
+    CheckExpand("X{#hello}", "X#Hello%20World!");
+    CheckExpand("map?{x,y}", "map?1024,768");
+    CheckExpand("{x,hello,y}", "1024,Hello%20World%21,768");
+    CheckExpand("{+x,hello,y}", "1024,Hello%20World!,768");
+    CheckExpand("{+path,x}/here", "/foo/bar,1024/here");
+    CheckExpand("{#x,hello,y}", "#1024,Hello%20World!,768");
+    CheckExpand("{#path,x}/here", "#/foo/bar,1024/here");
+    CheckExpand("X{.var}", "X.value");
+    CheckExpand("X{.x,y}", "X.1024.768");
+    CheckExpand("{/var}", "/value");
+    CheckExpand("{/var,x}/here", "/value/1024/here");
+    CheckExpand("{;x,y}", ";x=1024;y=768");
+    CheckExpand("{;x,y,empty}", ";x=1024;y=768;empty");
+    CheckExpand("{?x,y}", "?x=1024&y=768");
+    CheckExpand("{?x,y,empty}", "?x=1024&y=768&empty=");
+    CheckExpand("?fixed=yes{&x}", "?fixed=yes&x=1024");
+    CheckExpand("{&x,y,empty}", "&x=1024&y=768&empty=");
+
+    // Prefix modifiers, undefined variables and literals
+    CheckExpand("{var:3}", "val");
+    CheckExpand("{var:30}", "value");
+    CheckExpand("{+path:6}/here", "/foo/b/here");
+    CheckExpand("a{undefined}b{?undefined}", "ab");
+    CheckExpand("{?undefined,x}", "?x=1024");
+    CheckExpand("http://h/a b", "http://h/a%20b");
+    CheckExpand("", "");
+  }
+
+  void TestMalformedTemplates()
+  {
+    for (const char* uri_template : { "{var", "{}", "{var:0}", "{var:10000}", "{va r}" })
+    {
+      try
+      {
+        tURITemplate compiled(uri_template);
+        RRLIB_UNIT_TESTS_ASSERT_MESSAGE(std::string("No exception for ") + uri_template, false);
+      }
+      catch (const std::invalid_argument&)
+      {}
+    }
+  }
+};
+
+class TestInstrumentation : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestInstrumentation);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestTopLevelCounting);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void TestTopLevelCounting()
+  {
+    instrumentation::ResetStatistics();
+    tURIElements elements;
+    tURI("http://host/a%20b/c").Parse(elements);
+    try
+    {
+      tURI("http://host/%zz").Parse(elements);
+    }
+    catch (const std::invalid_argument&)
+    {}
+    std::string decoded;
+    tURI::Decode(decoded, "a%20b");
+
+    instrumentation::tStatistics statistics = instrumentation::GetStatistics();
+    if (!instrumentation::Enabled())
+    {
+      RRLIB_UNIT_TESTS_EQUALITY(uint64_t(0), statistics[instrumentation::tOperation::PARSE].calls);
+      return;
+    }
+
+    // Decode and tPath::Set performed by Parse are not counted separately
+    RRLIB_UNIT_TESTS_EQUALITY(uint64_t(2), statistics[instrumentation::tOperation::PARSE].calls);
+    RRLIB_UNIT_TESTS_EQUALITY(uint64_t(1), statistics[instrumentation::tOperation::PARSE].errors);
+    RRLIB_UNIT_TESTS_EQUALITY(uint64_t(strlen("http://host/a%20b/c") + strlen("http://host/%zz")), statistics[instrumentation::tOperation::PARSE].bytes);
+    RRLIB_UNIT_TESTS_EQUALITY(uint64_t(1), statistics[instrumentation::tOperation::DECODE].calls);
+    RRLIB_UNIT_TESTS_EQUALITY(uint64_t(5), statistics[instrumentation::tOperation::DECODE].bytes);
+    RRLIB_UNIT_TESTS_EQUALITY(uint64_t(0), statistics[instrumentation::tOperation::PATH_SET].calls);
+  }
+};
+
+class TestPercentCoding : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestPercentCoding);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestStreamingEncoder);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestStreamingDecoder);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  /*! Input with characters that are encoded - including a null character */
+  static std::string GetDecodedInput()
+  {
+    return std::string("a b/\xc3\xa4%?#\0x~", 13);
+  }
+
+  void TestStreamingEncoder()
+  {
+    const std::string input = GetDecodedInput();
+    for (const char* unencoded_reserved_characters : { tURI::cUNENCODED_RESERVED_CHARACTERS_PATH, tURI::cUNENCODED_RESERVED_CHARACTERS_QUERY_PARAMETER })
+    {
+      std::string expected;
+      tURI::Encode(expected, input, unencoded_reserved_characters);
+
+      // All combinations of input chunk and output buffer sizes (so that percent-encodings are split at every position)
+      tPercentEncoder encoder(unencoded_reserved_characters);
+      for (size_t chunk_size = 1; chunk_size <= input.length(); chunk_size++)
+      {
+        for (size_t output_size = 1; output_size <= 4; output_size++)
+        {
+          encoder.Reset();
+          std::string result;
+          char output[4];
+          for (size_t chunk_begin = 0; chunk_begin < input.length(); chunk_begin += chunk_size)
+          {
+            tStringRange chunk(input.c_str() + chunk_begin, std::min(chunk_size, input.length() - chunk_begin));
+            while (chunk.Length())
+            {
+              result.append(output, encoder.Encode(chunk, output, output_size));
+            }
+          }
+          while (encoder.HasPendingOutput())
+          {
+            result.append(output, encoder.Flush(output, output_size));
+          }
+          RRLIB_UNIT_TESTS_EQUALITY(expected, result);
+        }
+      }
+    }
+  }
+
+  void TestStreamingDecoder()
+  {
+    const std::string expected = GetDecodedInput();
+    std::string input;
+    tURI::Encode(input, expected, "");
+    tPercentDecoder decoder;
+    for (size_t chunk_size = 1; chunk_size <= input.length(); chunk_size++)
+    {
+      for (size_t output_size = 1; output_size <= 3; output_size++)
+      {
+        decoder.Reset();
+        std::string result;
+        char output[3];
+        for (size_t chunk_begin = 0; chunk_begin < input.length(); chunk_begin += chunk_size)
+        {
+          tStringRange chunk(input.c_str() + chunk_begin, std::min(chunk_size, input.length() - chunk_begin));
+          while (chunk.Length())
+          {
+            result.append(output, decoder.Decode(chunk, output, output_size));
+          }
+        }
+        decoder.Finish();
+        RRLIB_UNIT_TESTS_EQUALITY(expected, result);
+      }
+    }
+
+    // Invalid percent-encodings - also if split across chunks
+    for (const char* invalid : { "a%zz", "%4g", "%%41" })
+    {
+      for (size_t chunk_size = 1; chunk_size <= strlen(invalid); chunk_size++)
+      {
+        decoder.Reset();
+        char output[8];
+        bool thrown = false;
+        try
+        {
+          for (size_t chunk_begin = 0; chunk_begin < strlen(invalid); chunk_begin += chunk_size)
+          {
+            tStringRange chunk(invalid + chunk_begin, std::min(chunk_size, strlen(invalid) - chunk_begin));
+            decoder.Decode(chunk, output, sizeof(output));
+          }
+        }
+        catch (const std::invalid_argument&)
+        {
+          thrown = true;
+        }
+        RRLIB_UNIT_TESTS_ASSERT_MESSAGE(invalid, thrown);
+      }
+    }
+
+    // Incomplete percent-encoding at end
+    decoder.Reset();
+    char output[8];
+    tStringRange chunk("ab%4");
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), decoder.Decode(chunk, output, sizeof(output)));
+    RRLIB_UNIT_TESTS_ASSERT(chunk.Length() == 0);
+    bool thrown = false;
+    try
+    {
+      decoder.Finish();
+    }
+    catch (const std::invalid_argument&)
+    {
+      thrown = true;
+    }
+    RRLIB_UNIT_TESTS_ASSERT(thrown);
+  }
+};
+
+class TestPathDictionary : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestPathDictionary);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestRoundTrip);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestInvalidFiles);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  const std::string cFILE_NAME = "test_uri_path_dictionary.bin";
+
+  /*! Writes file with specified content */
+  void WriteFile(const std::string& content)
+  {
+    std::ofstream stream(cFILE_NAME, std::ios::binary | std::ios::trunc);
+    stream.write(content.data(), content.length());
+  }
+
+  /*! Reads content of file */
+  std::string ReadFile()
+  {
+    std::ifstream stream(cFILE_NAME, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  }
+
+  void TestRoundTrip()
+  {
+    std::vector<tPath> paths = { tPath("/robot/arm"), tPath("/robot"), tPath("a/b"), tPath("/"), tPath(""), tPath("/robot/arm"), tPath("//x") };
+    for (int i = 0; i < 100; i++)
+    {
+      paths.emplace_back("/generated/" + std::to_string(i));
+    }
+    tPathDictionary::Write(cFILE_NAME, paths);
+    {
+      // Rewriting a file that is mapped must not affect the mapping
+      tPathDictionary mapped(cFILE_NAME);
+      tPathDictionary::Write(cFILE_NAME, paths);
+      RRLIB_UNIT_TESTS_EQUALITY(paths.size() - 1, mapped.Size());
+    }
+
+    tPathDictionary dictionary(cFILE_NAME);
+    RRLIB_UNIT_TESTS_EQUALITY(paths.size() - 1, dictionary.Size());  // duplicate is removed
+    for (const tPath & path : paths)
+    {
+      size_t index = dictionary.Find(path);
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE(path.ToString(), index < dictionary.Size() && dictionary[index] == path);
+      RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(path.ToString(), index, dictionary.LowerBound(path));
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(tPathDictionary::cNOT_FOUND, dictionary.Find(tPath("/robot/leg")));
+    RRLIB_UNIT_TESTS_EQUALITY(dictionary.Find(tPath("/robot/arm")) + 1, dictionary.LowerBound(tPath("/robot/arm/x")));
+    RRLIB_UNIT_TESTS_EQUALITY(dictionary.Size(), dictionary.LowerBound(tPath("z")));
+  }
+
+  void TestInvalidFiles()
+  {
+    tPathDictionary::Write(cFILE_NAME, { tPath("/a/b"), tPath("/c") });
+    const std::string valid = ReadFile();
+    std::remove(cFILE_NAME.c_str());
+
+    // Truncated and corrupted files (every 32 bit value set to 0xFFFFFFFF in turn)
+    std::vector<std::string> invalid_files = { valid.substr(0, valid.length() - 1), valid.substr(0, 10) };
+    for (size_t i = 8; i + 4 <= valid.length(); i += 4)
+    {
+      invalid_files.push_back(valid);
+      memset(&invalid_files.back()[i], 0xFF, 4);
+    }
+
+    // Full hash index (Find() would not terminate): header contains path count, element offset count and hash index size at bytes 12 to 23
+    uint32_t header_values[3];
+    memcpy(header_values, &valid[12], sizeof(header_values));
+    size_t hash_index_offset = 32 + header_values[0] * 12 + header_values[1] * 4;
+    std::string full_hash_index = valid;
+    memset(&full_hash_index[hash_index_offset], 0, header_values[2] * 4);
+    WriteFile(full_hash_index);
+    try
+    {
+      tPathDictionary dictionary(cFILE_NAME);
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE("No exception for full hash index", false);
+    }
+    catch (const std::runtime_error&)
+    {}
+    for (const std::string & content : invalid_files)
+    {
+      WriteFile(content);
+      try
+      {
+        tPathDictionary dictionary(cFILE_NAME);
+        RRLIB_UNIT_TESTS_ASSERT(dictionary.Find(tPath("/x")) == tPathDictionary::cNOT_FOUND);
+      }
+      catch (const std::runtime_error&)
+      {}
+    }
+
+    std::remove(cFILE_NAME.c_str());
+    try
+    {
+      tPathDictionary dictionary(cFILE_NAME);
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE("No exception for missing file", false);
+    }
+    catch (const std::runtime_error&)
+    {}
+  }
+};
+
+class TestPathBatch : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestPathBatch);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestAppend);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestSort);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestSerialization);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  /*! Path strings with all special cases of tPath::Set() */
+  static std::vector<const char*> GetPathStrings()
+  {
+    return { "", "/", "a", "/a/b", "a/b/", "//", "a//", "///", "/robot/arm/Sensor Output" };
+  }
+
+  void TestAppend()
+  {
+    tPathBatch batch;
+    batch.Reserve(4, 8, 64);
+    for (const char* path_string : GetPathStrings())
+    {
+      batch.Append(tPath(path_string));
+      batch.Append(path_string);
+    }
+    batch.Append(tStringRange("a.b.c"), '.');
+    RRLIB_UNIT_TESTS_EQUALITY(2 * GetPathStrings().size() + 1, batch.Size());
+    for (size_t i = 0; i < GetPathStrings().size(); i++)
+    {
+      tPath expected(GetPathStrings()[i]);
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE(GetPathStrings()[i], batch[2 * i] == expected && batch[2 * i + 1] == expected);
+      RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(GetPathStrings()[i], expected.IsAbsolute(), batch[2 * i + 1].IsAbsolute());
+    }
+    RRLIB_UNIT_TESTS_ASSERT(batch[batch.Size() - 1] == tPath("a/b/c"));
+
+    batch.Clear();
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(0), batch.Size());
+  }
+
+  void TestSort()
+  {
+    tPathBatch batch;
+    for (const char* path_string : { "/b", "/a/c", "a", "/a" })
+    {
+      batch.Append(path_string);
+    }
+    batch.Sort();
+    RRLIB_UNIT_TESTS_ASSERT(batch[0] == tPath("/a") && batch[1] == tPath("/a/c") && batch[2] == tPath("/b") && batch[3] == tPath("a"));
+
+    batch.Sort([](const tPathView & lhs, const tPathView & rhs)
+    {
+      return lhs.Size() > rhs.Size();
+    });
+    RRLIB_UNIT_TESTS_ASSERT(batch[0] == tPath("/a/c"));
+  }
+
+  void TestSerialization()
+  {
+    tPathBatch batch;
+    for (const char* path_string : GetPathStrings())
+    {
+      batch.Append(path_string);
+    }
+    serialization::tMemoryBuffer buffer;
+    serialization::tOutputStream output(buffer);
+    output << batch;
+    output.Close();
+    serialization::tInputStream input(buffer);
+    tPathBatch deserialized;
+    deserialized.Append("/previous/content");
+    input >> deserialized;
+    RRLIB_UNIT_TESTS_EQUALITY(batch.Size(), deserialized.Size());
+    for (size_t i = 0; i < batch.Size(); i++)
+    {
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE(GetPathStrings()[i], batch[i] == deserialized[i]);
+    }
+
+    // Batch whose path string is not null-terminated (entry count, offset count, character count, entry, offset table, characters)
+    serialization::tMemoryBuffer corrupted_buffer;
+    serialization::tOutputStream corrupted_output(corrupted_buffer);
+    for (int value : { 1, 2, 2, 0, 0, 1, 1, 2 })
+    {
+      corrupted_output.WriteInt(value);
+    }
+    corrupted_output.Write("/x", 2);
+    corrupted_output.Close();
+    serialization::tInputStream corrupted_input(corrupted_buffer);
+    try
+    {
+      corrupted_input >> deserialized;
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE("No exception for invalid batch", false);
+    }
+    catch (const std::runtime_error&)
+    {}
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(0), deserialized.Size());
+  }
+};
+
+class TestPathString : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestPathString);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestStringAccess);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestAlternativeSeparator);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void TestStringAccess()
+  {
+    for (const char* path_string : { "", "/", "a", "/a/b", "/a//b" })
+    {
+      tPath path(path_string);
+      RRLIB_UNIT_TESTS_EQUALITY(std::string(path_string), std::string(path.CString()));
+      RRLIB_UNIT_TESTS_EQUALITY(std::string(path_string), ToString(path.ToStringRange()));
+      RRLIB_UNIT_TESTS_EQUALITY(strlen(path_string) + 1, path.TotalCharacters());
+      std::ostringstream stream;
+      stream << path;
+      RRLIB_UNIT_TESTS_EQUALITY(std::string(path_string), stream.str());
+    }
+
+    // No copies: string references path's memory
+    tPath path("/a/b");
+    RRLIB_UNIT_TESTS_ASSERT(path.CString() == path.ToStringRange().CharPointer() && path.CString() + 1 == path[0].CharPointer());
+
+    // Trailing separators are not part of path string
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("/a/b"), std::string(tPath("/a/b/").CString()));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("a/"), std::string(tPath("a//").CString()));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("/"), std::string(tPath("//").CString()));
+  }
+
+  void TestAlternativeSeparator()
+  {
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("robot.arm.position"), tPath("robot/arm/position").ToString('.'));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string(".robot.arm"), tPath("/robot/arm").ToString('.'));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("."), tPath("/").ToString('.'));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string(""), tPath().ToString('.'));
+
+    // Slashes inside elements are kept
+    std::vector<std::string> elements = { "a/b", "c" };
+    tPath path(true, elements.begin(), elements.end());
+    RRLIB_UNIT_TESTS_EQUALITY(std::string(".a/b.c"), path.ToString('.'));
+
+    char buffer[16];
+    memset(buffer, '#', sizeof(buffer));
+    char* end = path.WriteString(buffer, '.');
+    RRLIB_UNIT_TESTS_ASSERT(end == buffer + 6 && (*end) == 0 && buffer[7] == '#');
+    RRLIB_UNIT_TESTS_EQUALITY(std::string(".a/b.c"), std::string(buffer));
+  }
+};
+
+class TestStringInterop : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestStringInterop);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestMove);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestStringView);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void TestMove()
+  {
+    // Strings are long enough not to be stored in small string buffer
+    std::string uri_string = "http://host/a/rather/long/path/that/is/allocated/on/the/heap";
+    const char* buffer = uri_string.c_str();
+    tURI uri(std::move(uri_string));
+    RRLIB_UNIT_TESTS_ASSERT(uri.ToString().c_str() == buffer);
+
+    std::string other_string = "http://host/another/rather/long/path/that/is/allocated/on/the/heap";
+    buffer = other_string.c_str();
+    uri.Set(std::move(other_string));
+    RRLIB_UNIT_TESTS_ASSERT(uri.ToString().c_str() == buffer);
+
+    // Copies from ranges reuse memory already allocated
+    buffer = uri.ToString().c_str();
+    uri.Set(tStringRange("http://h/x"));
+    RRLIB_UNIT_TESTS_ASSERT(uri.ToString().c_str() == buffer);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("http://h/x"), uri.ToString());
+  }
+
+  void TestStringView()
+  {
+#if __cplusplus >= 201703L
+    std::string_view view = "http://host/a%20b?x=1#f";
+    tStringRange range = view;
+    RRLIB_UNIT_TESTS_ASSERT(range.CharPointer() == view.data() && range.Length() == view.length());
+    std::string_view converted = range;
+    RRLIB_UNIT_TESTS_ASSERT(converted == view);
+
+    tURIElements elements;
+    tURI::Parse(view.substr(0, 17), elements);
+    RRLIB_UNIT_TESTS_ASSERT(elements.path == tPath("/a b"));
+    std::string decoded;
+    tURI::Decode(decoded, view.substr(11, 6));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("/a b"), decoded);
+    tPath path;
+    path.Set(view.substr(11, 6), '/');
+    RRLIB_UNIT_TESTS_ASSERT(path == tPath("/a%20b"));
+#endif
+  }
+};
+
+class TestEquivalence : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestEquivalence);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestEquivalent);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestUnorderedMap);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  /*!
+   * Checks equivalence of URIs - and that equivalent URIs have the same hash
+   */
+  void CheckEquivalent(const char* lhs, const char* rhs, bool expected)
+  {
+    std::string message = std::string(lhs) + " vs. " + rhs;
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(message, expected, tURI::Equivalent(lhs, rhs));
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(message, expected, tURI::Equivalent(rhs, lhs));
+    if (expected)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(message, tURI::EquivalenceHash(lhs), tURI::EquivalenceHash(rhs));
+    }
+  }
+
+  void TestEquivalent()
+  {
+    // Syntax-based normalization
+    CheckEquivalent("HTTP://Example.COM/a", "http://example.com/a", true);
+    CheckEquivalent("http://h/%7euser", "http://h/~user", true);
+    CheckEquivalent("http://h/a%2fb", "http://h/a%2Fb", true);
+    CheckEquivalent("http://h/a%2Fb", "http://h/a/b", false);
+    CheckEquivalent("http://h/a/./b/../c", "http://h/a/c", true);
+    CheckEquivalent("http://h/A", "http://h/a", false);
+    CheckEquivalent("http://user@h/", "http://USER@h/", false);
+
+    // Scheme-based normalization for schemes with default ports
+    CheckEquivalent("http://h:80/", "http://h/", true);
+    CheckEquivalent("http://h:/", "http://h/", true);
+    CheckEquivalent("http://h", "http://h/", true);
+    CheckEquivalent("https://h:443", "https://h/", true);
+    CheckEquivalent("http://h:8080/", "http://h/", false);
+    CheckEquivalent("foo://h:80/", "foo://h/", false);
+
+    // Other components
+    CheckEquivalent("http://h/?q#f", "http://h/?q#f", true);
+    CheckEquivalent("http://h/?q", "http://h/?q#", false);
+    CheckEquivalent("http://h/?%61", "http://h/?a", true);
+    CheckEquivalent("a/b", "a/b", true);
+    CheckEquivalent("", "", true);
+
+    // Long paths with dot-segments
+    std::string long_path = "http://h";
+    for (int i = 0; i < 100; i++)
+    {
+      long_path += "/element/.";
+    }
+    std::string normalized_long_path = "http://h";
+    for (int i = 0; i < 100; i++)
+    {
+      normalized_long_path += "/element";
+    }
+    normalized_long_path += "/";
+    CheckEquivalent(long_path.c_str(), normalized_long_path.c_str(), true);
+  }
+
+  void TestUnorderedMap()
+  {
+    std::unordered_map<tURI, int, tURI::tEquivalenceHash, tURI::tEquivalentTo> map;
+    map[tURI("http://Example.com:80/a%7e")] = 1;
+    map[tURI("http://example.com/b")] = 2;
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(1), map.count(tURI("HTTP://example.COM/a~")));
+    RRLIB_UNIT_TESTS_EQUALITY(1, map[tURI("HTTP://example.COM/a~")]);
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), map.size());
+  }
+};
+
+class TestValidate : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestValidate);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestValidURIs);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestErrorOffsets);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void TestValidURIs()
+  {
+    for (const char* uri : { "http://h/a?b=c#d", "", "a/b", "//h", "mailto:x@y", "http://[::1]:8080/", "http://user:pw@h/", "a:b:c", "http://h/a%20b?q=%C3%A4" })
+    {
+      size_t error_offset = 12345;
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE(uri, tURI::Validate(uri, &error_offset) && tURI(uri).IsValid());
+      RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(uri, size_t(12345), error_offset);
+    }
+
+    // Long runs of valid characters (scanned in blocks) with invalid character at every position
+    std::string long_uri = "http://host/" + std::string(100, 'a') + "?" + std::string(100, 'b');
+    RRLIB_UNIT_TESTS_ASSERT(tURI::Validate(long_uri));
+    for (size_t i = 12; i < long_uri.length(); i++)
+    {
+      std::string invalid = long_uri;
+      invalid[i] = ' ';
+      size_t error_offset = 0;
+      RRLIB_UNIT_TESTS_ASSERT(!tURI::Validate(invalid, &error_offset));
+      RRLIB_UNIT_TESTS_EQUALITY(i, error_offset);
+    }
+  }
+
+  void TestErrorOffsets()
+  {
+    const std::vector<std::pair<const char*, size_t>> invalid_uris =
+    {
+      { "ht tp://h", 2 },         // space in scheme
+      { ":a", 0 },                // empty scheme
+      { "%41:b", 0 },             // colon in first segment of relative reference
+      { "http://h h/", 8 },       // space in host
+      { "http://h:8x/", 10 },     // invalid port
+      { "http://[::g]/", 8 },     // invalid IP literal
+      { "http://h/a b", 10 },     // space in path
+      { "http://h/%zz", 9 },      // invalid percent-encoding
+      { "http://h/?a%4", 11 },    // incomplete percent-encoding in query
+      { "http://h/#a#b", 11 },    // '#' in fragment
+      { "foo:/a/{b}", 7 },        // character outside of RFC 3986 character set
+      { "http://h/\xc3\xa4", 9 }  // non-ASCII character (IRIs are not URIs)
+    };
+    for (const std::pair<const char*, size_t>& invalid_uri : invalid_uris)
+    {
+      size_t error_offset = 12345;
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE(invalid_uri.first, !tURI::Validate(invalid_uri.first, &error_offset));
+      RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(invalid_uri.first, invalid_uri.second, error_offset);
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE(invalid_uri.first, !tURI(invalid_uri.first).IsValid());
+    }
+  }
+};
+
+class TestIRI : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestIRI);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestURIToIRI);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestIRIToURI);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestDecode);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void CheckURIToIRI(const char* uri, const char* expected_iri)
+  {
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(uri, std::string(expected_iri), tIRI(tURI(uri)).ToString());
+  }
+
+  void TestURIToIRI()
+  {
+    CheckURIToIRI("http://h/Stra%C3%9Fe/%E2%82%AC%2F", "http://h/Stra\xc3\x9f" "e/\xe2\x82\xac%2F");
+    CheckURIToIRI("http://h/%F0%9F%98%80?%F0%9F%98%80#%F0%9F%98%80", "http://h/\xf0\x9f\x98\x80?\xf0\x9f\x98\x80#\xf0\x9f\x98\x80");
+
+    // Invalid UTF-8 and characters that are not allowed in IRIs remain percent-encoded
+    CheckURIToIRI("http://h/%FF/%C3/%ED%A0%80", "http://h/%FF/%C3/%ED%A0%80");
+    CheckURIToIRI("http://h/%C2%85%C2%A0", "http://h/%C2%85\xc2\xa0");                       // C1 control (U+0085)
+    CheckURIToIRI("http://h/%E2%80%8F%E2%80%AE%E2%81%A6", "http://h/%E2%80%8F%E2%80%AE%E2%81%A6");  // bidi formatting characters
+    CheckURIToIRI("http://h/%EF%BF%BE%EF%B7%90%F0%9F%BF%BF", "http://h/%EF%BF%BE%EF%B7%90%F0%9F%BF%BF");  // non-characters
+    CheckURIToIRI("http://h/%F3%A0%80%81", "http://h/%F3%A0%80%81");                         // U+E0001 (tag - not in ucschar)
+
+    // Private use characters are only decoded in the query
+    CheckURIToIRI("http://h/%EE%80%80?%EE%80%80#%EE%80%80", "http://h/%EE%80%80?\xee\x80\x80#%EE%80%80");
+    CheckURIToIRI("http://h/a?%F4%8F%BF%BD", "http://h/a?\xf4\x8f\xbf\xbd");
+  }
+
+  void TestIRIToURI()
+  {
+    tIRI iri("http://h/Stra\xc3\x9f" "e?q=\xe2\x82\xac");
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("http://h/Stra%C3%9Fe?q=%E2%82%AC"), iri.ToURI().ToString());
+    RRLIB_UNIT_TESTS_EQUALITY(iri.ToURI().ToString().length(), tIRI::URILength(iri.ToString()));
+    RRLIB_UNIT_TESTS_EQUALITY(iri.ToString(), tIRI(iri.ToURI()).ToString());
+
+    std::vector<std::string> elements = { "Gr\xc3\xbc\xc3\x9f" "e", "a b" };
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("/Gr\xc3\xbc\xc3\x9f" "e/a%20b"), tIRI(tPath(true, elements.begin(), elements.end())).ToString());
+
+    try
+    {
+      tIRI("x\xff").ToURI();
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE("No exception for invalid UTF-8", false);
+    }
+    catch (const std::invalid_argument&)
+    {}
+    RRLIB_UNIT_TESTS_ASSERT(tIRI::IsValidUTF8("a\xc3\xa4" "b") && (!tIRI::IsValidUTF8("\xc0\xaf")) && (!tIRI::IsValidUTF8("\xed\xa0\x80")) && (!tIRI::IsValidUTF8("\xf4\x90\x80\x80")));
+  }
+
+  void TestDecode()
+  {
+    char buffer[32];
+    char* end = tIRI::Decode(buffer, "Gr%C3%BC%C3%9Fe");
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("Gr\xc3\xbc\xc3\x9f" "e"), std::string(buffer, end));
+    end = tIRI::Decode(buffer, "a%00b");
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("a\0b", 3), std::string(buffer, end));
+    for (const char* invalid : { "%C3", "%ED%A0%80", "%C0%AF", "a%zz" })
+    {
+      try
+      {
+        tIRI::Decode(buffer, invalid);
+        RRLIB_UNIT_TESTS_ASSERT_MESSAGE(std::string("No exception for ") + invalid, false);
+      }
+      catch (const std::invalid_argument&)
+      {}
+    }
+  }
+};
+
+class TestLazyURIElements : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestLazyURIElements);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestElements);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestPathEquals);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void TestElements()
+  {
+    tURI uri("http://h:80/a%20b/c?q=1#f");
+    tLazyURIElements elements;
+    uri.Parse(elements);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("http"), ToString(elements.Scheme()));
+    RRLIB_UNIT_TESTS_ASSERT(elements.SchemeID() == tSchemeID::HTTP);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("h:80"), ToString(elements.Authority()));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("/a%20b/c"), ToString(elements.EncodedPath()));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("q=1"), ToString(elements.Query()));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("f"), ToString(elements.Fragment()));
+    RRLIB_UNIT_TESTS_ASSERT(elements.Path() == tPath("/a b/c"));
+
+    // Reuse with another URI
+    elements.Set("rel/x%2Fy");
+    RRLIB_UNIT_TESTS_ASSERT(elements.SchemeID() == tSchemeID::UNKNOWN && elements.Scheme().Length() == 0);
+    RRLIB_UNIT_TESTS_ASSERT(elements.Path() == tPath("rel/x/y"));
+
+    elements.Set("http://h/%zz");
+    try
+    {
+      elements.Path();
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE("No exception for invalid path", false);
+    }
+    catch (const std::invalid_argument&)
+    {}
+  }
+
+  void TestPathEquals()
+  {
+    // PathEquals() must yield the same result as comparing the decoded path - with and without decoding
+    for (const char* uri : { "http://h/a/b", "http://h/a/b/", "rel/x", "x", "http://h", "http://h/a%20b/c", "?q", "http://h/a//b", "http://h//" })
+    {
+      for (const char* path_string : { "/a/b", "a/b", "rel/x", "x", "/a b/c", "/a//b", "", "/a/b/c", "/", "//" })
+      {
+        tPath path(path_string);
+        tLazyURIElements decoded(uri);
+        bool expected = decoded.Path() == path;
+        tLazyURIElements lazy(uri);
+        RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(std::string(uri) + " vs. " + path_string, expected, lazy.PathEquals(path));
+        RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(std::string(uri) + " vs. " + path_string, expected, decoded.PathEquals(path));
+      }
+    }
+
+    // Path elements containing slashes
+    std::vector<std::string> elements = { "a/b" };
+    tLazyURIElements lazy("a/b");
+    RRLIB_UNIT_TESTS_ASSERT(!lazy.PathEquals(tPath(false, elements.begin(), elements.end())));
+  }
+};
+
+class TestParsedURI : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestParsedURI);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestSerialization);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestInvalidBoundaries);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void TestSerialization()
+  {
+    for (const char* uri : { "", "http://u@h:80/a/b%20c/?q=1#f", "mailto:x@y", "//h", "/p", "?q", "#f", "a:", "http://h?", "http://h#", "file:///" })
+    {
+      for (bool decode_path : { false, true })
+      {
+        tParsedURI parsed(tURI(uri), decode_path);
+        RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(uri, decode_path, parsed.IsPathDecoded());
+        serialization::tMemoryBuffer buffer;
+        serialization::tOutputStream output(buffer);
+        output << parsed;
+        output.Close();
+        serialization::tInputStream input(buffer);
+        tParsedURI deserialized;
+        input >> deserialized;
+
+        RRLIB_UNIT_TESTS_EQUALITY_MESSAGE(uri, std::string(uri), deserialized.URI().ToString());
+        RRLIB_UNIT_TESTS_ASSERT_MESSAGE(uri, !deserialized.IsPathDecoded());  // decoded path is not transferred
+        tURIView expected(uri), view = deserialized.View();
+        RRLIB_UNIT_TESTS_ASSERT_MESSAGE(uri, expected.scheme == view.scheme && expected.authority == view.authority && expected.path == view.path &&
+                                        expected.query == view.query && expected.fragment == view.fragment);
+        RRLIB_UNIT_TESTS_ASSERT_MESSAGE(uri, expected.has_authority == view.has_authority && expected.has_query == view.has_query && expected.has_fragment == view.has_fragment);
+
+        // GetElements() is const and decodes path without modifying the object
+        const tParsedURI& const_deserialized = deserialized;
+        tURIElements elements, expected_elements;
+        tURI(uri).Parse(expected_elements);
+        const_deserialized.GetElements(elements);
+        RRLIB_UNIT_TESTS_ASSERT_MESSAGE(uri, elements.path == expected_elements.path && elements.authority == expected_elements.authority && elements.query == expected_elements.query);
+        RRLIB_UNIT_TESTS_ASSERT_MESSAGE(uri, !deserialized.IsPathDecoded());
+        RRLIB_UNIT_TESTS_ASSERT_MESSAGE(uri, deserialized.Path() == expected_elements.path && deserialized.IsPathDecoded());
+      }
+    }
+  }
+
+  void TestInvalidBoundaries()
+  {
+    // Boundaries of "http://h/p?q#f" with lengths that do not match delimiters - or exceed the URI string (also if added up)
+    const std::vector<std::vector<uint32_t>> invalid_lengths =
+    {
+      { 3, 1, 2, 1 }, { 4, 2, 2, 1 }, { 4, 1, 3, 1 }, { 4, 1, 2, 3 }, { 4, 1, 2, 100 },
+      { 0xFFFFFFFF, 1, 2, 1 }, { 4, 0xFFFFFFFF, 2, 1 }, { 4, 1, 0xFFFFFFFF, 0xFFFFFFFF }, { 4, 0x80000000, 0x80000000, 1 }
+    };
+    for (const std::vector<uint32_t>& lengths : invalid_lengths)
+    {
+      serialization::tMemoryBuffer buffer;
+      serialization::tOutputStream output(buffer);
+      output << std::string("http://h/p?q#f");
+      output.WriteByte(7);  // has authority, query, and fragment
+      for (uint32_t length : lengths)
+      {
+        output.WriteInt(static_cast<int32_t>(length));
+      }
+      output.Close();
+      serialization::tInputStream input(buffer);
+      tParsedURI deserialized;
+      try
+      {
+        input >> deserialized;
+        RRLIB_UNIT_TESTS_ASSERT_MESSAGE("No exception for invalid boundaries", false);
+      }
+      catch (const std::runtime_error&)
+      {}
+      RRLIB_UNIT_TESTS_EQUALITY(std::string(), deserialized.URI().ToString());
+    }
+  }
+};
+
+class TestInPlaceCoding : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestInPlaceCoding);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestDecodeInPlace);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestExactLengths);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void TestDecodeInPlace()
+  {
+    std::string string = "a%20b%2Fc%zz";
+    try
+    {
+      tURI::DecodeInPlace(string);
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE("No exception for invalid percent-encoding", false);
+    }
+    catch (const std::invalid_argument&)
+    {}
+
+    string = "a%20b%2Fc%C3%A4" + std::string(40, 'x') + "%41";
+    tURI::DecodeInPlace(string);
+    RRLIB_UNIT_TESTS_EQUALITY("a b/c\xc3\xa4" + std::string(40, 'x') + "A", string);
+
+    // Decode() may write to the buffer of the encoded string
+    char buffer[] = "%41%42c%44";
+    char* end = tURI::Decode(buffer, tStringRange(buffer, strlen(buffer)));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("ABcD"), std::string(buffer, end));
+  }
+
+  void TestExactLengths()
+  {
+    for (const std::string& decoded : { std::string(), std::string("abc"), std::string("a b/c?d"), std::string(100, ' ') + "/" + std::string(100, 'a'), std::string("\xc3\xa4\0", 3) })
+    {
+      for (const char* unencoded_reserved_characters : { tURI::cUNENCODED_RESERVED_CHARACTERS_PATH, tURI::cUNENCODED_RESERVED_CHARACTERS_QUERY_PARAMETER, "" })
+      {
+        // Appending overloads produce the same results as writing to buffers of exact size
+        std::string encoded = "prefix";
+        tURI::Encode(encoded, decoded, unencoded_reserved_characters);
+        size_t encoded_length = tURI::EncodedLength(decoded, unencoded_reserved_characters);
+        RRLIB_UNIT_TESTS_EQUALITY(encoded_length + 6, encoded.length());
+        std::vector<char> buffer(encoded_length + 1, '#');
+        char* end = tURI::Encode(buffer.data(), decoded, unencoded_reserved_characters);
+        RRLIB_UNIT_TESTS_ASSERT(end == buffer.data() + encoded_length && (*end) == '#');
+        RRLIB_UNIT_TESTS_EQUALITY(encoded.substr(6), std::string(buffer.data(), encoded_length));
+
+        tStringRange encoded_range(encoded.c_str() + 6, encoded_length);
+        RRLIB_UNIT_TESTS_EQUALITY(decoded.length(), tURI::DecodedLength(encoded_range));
+        std::string result = "prefix";
+        tURI::Decode(result, encoded_range);
+        RRLIB_UNIT_TESTS_EQUALITY("prefix" + decoded, result);
+      }
+    }
+  }
+};
+
+class TestSchemeRegistry : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestSchemeRegistry);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestLookup);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestParseHook);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  static int hook_calls;
+
+  static void ParseHook(const tURIView& view, tURIElements& result, bool normalize_path)
+  {
+    hook_calls++;
+    result.scheme.assign(view.scheme.CharPointer(), view.scheme.Length());
+    result.authority.clear();
+    result.path = tPath();
+    result.query.clear();
+    result.fragment = "hook";
+  }
+
+  void TestLookup()
+  {
+    for (size_t i = 1; i < static_cast<size_t>(tSchemeID::DIMENSION); i++)
+    {
+      tSchemeID id = static_cast<tSchemeID>(i);
+      std::string name = tSchemeRegistry::GetInfo(id).name, upper_case = name;
+      std::transform(upper_case.begin(), upper_case.end(), upper_case.begin(), ::toupper);
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE(name, tSchemeRegistry::GetID(name) == id);
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE(name, tSchemeRegistry::GetID(upper_case) == id);
+    }
+    RRLIB_UNIT_TESTS_ASSERT(tSchemeRegistry::GetID("Https") == tSchemeID::HTTPS);
+    for (const std::string& unknown : { std::string(), std::string("httpx"), std::string("htt"), std::string("h"), std::string("sftp"), std::string("http\0", 5), std::string("ht\0p", 4) })
+    {
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE(unknown, tSchemeRegistry::GetID(unknown) == tSchemeID::UNKNOWN);
+    }
+
+    RRLIB_UNIT_TESTS_EQUALITY(std::string(), std::string(tSchemeRegistry::GetInfo(tSchemeID::UNKNOWN).name));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("https"), std::string(tSchemeRegistry::GetInfo(tSchemeID::HTTPS).name));
+    RRLIB_UNIT_TESTS_EQUALITY(80, static_cast<int>(tSchemeRegistry::GetDefaultPort(tSchemeID::HTTP)));
+    RRLIB_UNIT_TESTS_EQUALITY(443, static_cast<int>(tSchemeRegistry::GetDefaultPort(tSchemeID::HTTPS)));
+    RRLIB_UNIT_TESTS_EQUALITY(0, static_cast<int>(tSchemeRegistry::GetDefaultPort(tSchemeID::FILE)));
+    RRLIB_UNIT_TESTS_ASSERT(tSchemeRegistry::GetInfo(tSchemeID::FILE).default_port_string == nullptr);
+
+    tURIElements elements;
+    tURI("HTTP://example.com/a").Parse(elements);
+    RRLIB_UNIT_TESTS_ASSERT(elements.scheme_id == tSchemeID::HTTP);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("HTTP"), elements.scheme);
+    tURI("gopher://example.com/a").Parse(elements);
+    RRLIB_UNIT_TESTS_ASSERT(elements.scheme_id == tSchemeID::UNKNOWN);
+    tURI("/a").Parse(elements);
+    RRLIB_UNIT_TESTS_ASSERT(elements.scheme_id == tSchemeID::UNKNOWN);
+  }
+
+  void TestParseHook()
+  {
+    try
+    {
+      tSchemeRegistry::SetParseHook(tSchemeID::UNKNOWN, &ParseHook);
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE("No exception setting hook for unknown scheme", false);
+    }
+    catch (const std::invalid_argument&)
+    {}
+
+    hook_calls = 0;
+    tSchemeRegistry::SetParseHook(tSchemeID::DATA, &ParseHook);
+    RRLIB_UNIT_TESTS_ASSERT(tSchemeRegistry::GetParseHook(tSchemeID::DATA) == &ParseHook);
+    RRLIB_UNIT_TESTS_ASSERT(tSchemeRegistry::GetParseHook(tSchemeID::HTTP) == nullptr);
+
+    tURIElements elements;
+    tURI("data:text/plain;a%20b").Parse(elements);
+    RRLIB_UNIT_TESTS_EQUALITY(1, hook_calls);
+    RRLIB_UNIT_TESTS_ASSERT(elements.scheme_id == tSchemeID::DATA);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("hook"), elements.fragment);
+    RRLIB_UNIT_TESTS_EQUALITY(0u, elements.path.Size());
+
+    tURI("http://h/a").Parse(elements);
+    RRLIB_UNIT_TESTS_EQUALITY(1, hook_calls);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string(), elements.fragment);
+
+    tParsedURI parsed(tURI("DATA:x"));
+    parsed.GetElements(elements);
+    RRLIB_UNIT_TESTS_EQUALITY(2, hook_calls);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("DATA"), elements.scheme);
+
+    // Removing hook restores default parsing
+    tSchemeRegistry::SetParseHook(tSchemeID::DATA, nullptr);
+    RRLIB_UNIT_TESTS_ASSERT(tSchemeRegistry::GetParseHook(tSchemeID::DATA) == nullptr);
+    tURI("data:a%20b").Parse(elements);
+    RRLIB_UNIT_TESTS_EQUALITY(2, hook_calls);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string(), elements.fragment);
+    RRLIB_UNIT_TESTS_EQUALITY(1u, elements.path.Size());
+  }
+};
+
+int TestSchemeRegistry::hook_calls = 0;
+
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestPath);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestResolve);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestQuery);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestAuthority);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestNormalize);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestURIConstruction);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestPathPattern);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestURITemplate);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestInstrumentation);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestPercentCoding);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestPathDictionary);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestPathBatch);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestPathString);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestStringInterop);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestEquivalence);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestValidate);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestIRI);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestLazyURIElements);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestParsedURI);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestInPlaceCoding);
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestSchemeRegistry);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,273 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tools/benchmark.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * Multi-core scaling benchmark for the library's operations.
+ * Every operation is run single-threaded first - and then from N threads concurrently.
+ * Per-thread throughput and scaling efficiency (per-thread throughput with N threads relative to single-threaded throughput)
+ * are reported. Efficiency well below 100% indicates contention on shared state (e.g. allocator, locks, or shared cache lines).
+ * Operations reuse per-thread scratch objects - apart from those marked with '*': they return new tURI or tPath objects,
+ * so they allocate memory on every call and their scaling is limited by the allocator.
+ *
+ * Usage: rrlib_uri_benchmark [<threads> [<iterations per thread> [<operation>]]]
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tLazyURIElements.h"
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::uri;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! Scratch state of one benchmark thread (reused across iterations - as in applications) */
+struct tThreadState
+{
+  tURIElements elements;
+  tLazyURIElements lazy_elements;
+  tPath path;
+  tURI uri;
+  char buffer[1024];
+};
+
+/*! Benchmarked operation (returns some value derived from result - so that work is not optimized away) */
+struct tOperation
+{
+  const char* name;
+  size_t (*function)(tThreadState& state, size_t iteration);
+};
+
+}
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+static const std::vector<tURI> cURIS =
+{
+  tURI("http://www.example.com/documents/2017/report%20final.pdf?version=3&lang=en#page=12"),
+  tURI("tcp://robot-controller:4444/Main%20Thread/Sensor%20Fusion/Output/Pose"),
+  tURI("file:///home/user/finroc/sources/cpp/rrlib/uri/tURI.cpp"),
+  tURI("https://user@[2001:db8::7]:8443/a/./b/../c/%7Euser/index.html?q=%C3%A4"),
+  tURI("relative/path/to/port/Value")
+};
+static const std::vector<tPath> cPATHS =
+{
+  tPath("/Main Thread/Sensor Fusion/Output/Pose"),
+  tPath("/home/user/finroc/sources/cpp/rrlib/uri/tURI.cpp"),
+  tPath("relative/path/to/port/Value")
+};
+static const tURI cBASE_URI("http://a/b/c/d;p?q");
+static const tURIView cBASE_URI_VIEW(cBASE_URI.ToString());
+static const char* cREFERENCES[] = { "g", "./g/", "../../g", "?y", "g#s", "//g", "../g?x#y" };
+
+static const tOperation cOPERATIONS[] =
+{
+  {
+    "Parse", [](tThreadState & state, size_t i) -> size_t
+    {
+      cURIS[i % cURIS.size()].Parse(state.elements);
+      return state.elements.path.Size();
+    }
+  },
+  {
+    "Parse (lazy path)", [](tThreadState & state, size_t i) -> size_t
+    {
+      cURIS[i % cURIS.size()].Parse(state.lazy_elements);
+      return state.lazy_elements.EncodedPath().Length();
+    }
+  },
+  {
+    "Validate", [](tThreadState&, size_t i) -> size_t
+    {
+      return cURIS[i % cURIS.size()].IsValid() ? 1 : 0;
+    }
+  },
+  {
+    "Normalize", [](tThreadState & state, size_t i) -> size_t
+    {
+      state.uri.Set(tStringRange(cURIS[i % cURIS.size()].ToString()));
+      state.uri.Normalize();
+      return state.uri.ToString().length();
+    }
+  },
+  {
+    "Equivalent", [](tThreadState&, size_t i) -> size_t
+    {
+      return tURI::Equivalent(cURIS[i % cURIS.size()].ToString(), cURIS[(i + 1) % cURIS.size()].ToString()) ? 1 : 0;
+    }
+  },
+  {
+    "Resolve", [](tThreadState & state, size_t i) -> size_t
+    {
+      tURI::Resolve(cBASE_URI_VIEW, cREFERENCES[i % (sizeof(cREFERENCES) / sizeof(cREFERENCES[0]))], state.uri);
+      return state.uri.ToString().length();
+    }
+  },
+  {
+    "Encode", [](tThreadState & state, size_t i) -> size_t
+    {
+      const tPath& path = cPATHS[i % cPATHS.size()];
+      return tURI::Encode(state.buffer, path.ToStringRange(), tURI::cUNENCODED_RESERVED_CHARACTERS_PATH) - state.buffer;
+    }
+  },
+  {
+    "Decode", [](tThreadState & state, size_t i) -> size_t
+    {
+      return tURI::Decode(state.buffer, cURIS[i % cURIS.size()].ToString()) - state.buffer;
+    }
+  },
+  {
+    "URI from path*", [](tThreadState&, size_t i) -> size_t
+    {
+      return tURI(cPATHS[i % cPATHS.size()]).ToString().length();
+    }
+  },
+  {
+    "Path set", [](tThreadState & state, size_t i) -> size_t
+    {
+      state.path.Set(cPATHS[i % cPATHS.size()].ToStringRange(), '/');
+      return state.path.Size();
+    }
+  },
+  {
+    "Path append*", [](tThreadState&, size_t i) -> size_t
+    {
+      return cPATHS[i % cPATHS.size()].Append(cPATHS[(i + 2) % cPATHS.size()]).Size();
+    }
+  }
+};
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * Runs operation from the specified number of threads concurrently
+ *
+ * \param checksum Sum of values returned by operation is added to this variable
+ * \return Throughput of each thread (operations per second)
+ */
+static std::vector<double> Run(const tOperation& operation, size_t thread_count, size_t iterations, std::atomic<size_t>& checksum)
+{
+  std::vector<double> throughput(thread_count);
+  std::atomic<size_t> ready(0);
+  std::atomic<bool> start(false);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < thread_count; t++)
+  {
+    threads.emplace_back([&, t]()
+    {
+      tThreadState state;
+      size_t local_checksum = 0;
+      for (size_t i = 0; i < iterations / 10; i++)  // warm-up
+      {
+        local_checksum += operation.function(state, i);
+      }
+      ready++;
+      while (!start)
+      {
+        std::this_thread::yield();
+      }
+      auto begin = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < iterations; i++)
+      {
+        local_checksum += operation.function(state, i);
+      }
+      std::chrono::duration<double> duration = std::chrono::steady_clock::now() - begin;
+      throughput[t] = iterations / duration.count();
+      checksum += local_checksum;
+    });
+  }
+  while (ready < thread_count)
+  {
+    std::this_thread::yield();
+  }
+  start = true;
+  for (auto & thread : threads)
+  {
+    thread.join();
+  }
+  return throughput;
+}
+
+int main(int argc, char** argv)
+{
+  size_t thread_count = argc > 1 ? std::stoul(argv[1]) : std::max(1u, std::thread::hardware_concurrency());
+  size_t iterations = argc > 2 ? std::stoul(argv[2]) : 200000;
+  std::string operation_filter = argc > 3 ? argv[3] : "";
+  if (thread_count == 0 || iterations == 0)
+  {
+    std::cerr << "Usage: " << argv[0] << " [<threads> [<iterations per thread> [<operation>]]]" << std::endl;
+    return 1;
+  }
+
+  printf("%zu threads, %zu iterations per thread\n\n", thread_count, iterations);
+  std::atomic<size_t> checksum(0);
+  printf("%-20s %16s %16s %16s %16s %11s\n", "Operation", "1 thread [op/s]", "min [op/s]", "mean [op/s]", "max [op/s]", "Efficiency");
+  for (const tOperation & operation : cOPERATIONS)
+  {
+    if (operation_filter.length() && operation_filter != operation.name)
+    {
+      continue;
+    }
+    double single = Run(operation, 1, iterations, checksum)[0];
+    std::vector<double> concurrent = Run(operation, thread_count, iterations, checksum);
+    double min = concurrent[0], max = concurrent[0], sum = 0;
+    for (double value : concurrent)
+    {
+      min = std::min(min, value);
+      max = std::max(max, value);
+      sum += value;
+    }
+    double mean = sum / concurrent.size();
+    printf("%-20s %16.0f %16.0f %16.0f %16.0f %10.1f%%\n", operation.name, single, min, mean, max, 100.0 * mean / single);
+  }
+  printf("\n* allocates new object on every call\nChecksum: %zu\n", checksum.load());
+  return 0;
+}
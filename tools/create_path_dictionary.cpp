@@ -0,0 +1,115 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tools/create_path_dictionary.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * Creates a path dictionary file (see tPathDictionary) from a text file with one path per line.
+ *
+ * Usage: rrlib_uri_create_path_dictionary <input file ('-' for stdin)> <output file> [<separator>]
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <fstream>
+#include <iostream>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tPathDictionary.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::uri;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+  if (argc < 3 || argc > 4 || (argc == 4 && strlen(argv[3]) != 1))
+  {
+    std::cerr << "Usage: " << argv[0] << " <input file ('-' for stdin)> <output file> [<separator>]" << std::endl;
+    return 1;
+  }
+  char separator = argc == 4 ? argv[3][0] : '/';
+
+  std::ifstream file;
+  if (std::string(argv[1]) != "-")
+  {
+    file.open(argv[1]);
+    if (!file)
+    {
+      std::cerr << "Could not open '" << argv[1] << "'" << std::endl;
+      return 1;
+    }
+  }
+  std::istream& input = file.is_open() ? file : std::cin;
+
+  std::vector<tPath> paths;
+  std::string line;
+  while (std::getline(input, line))
+  {
+    if (line.length() && line.back() == '\r')
+    {
+      line.pop_back();
+    }
+    if (line.length())
+    {
+      paths.emplace_back(tStringRange(line), separator);
+    }
+  }
+
+  try
+  {
+    tPathDictionary::Write(argv[2], paths);
+    tPathDictionary dictionary(argv[2]);
+    std::cout << "Wrote " << dictionary.Size() << " paths to '" << argv[2] << "'" << std::endl;
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,502 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/uri/tools/process_uris.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * Bulk processing of newline-delimited URIs (e.g. from recorded traffic).
+ * The input file is memory-mapped and split into chunks that are processed in parallel.
+ * Either prints statistics on the URIs' components - or extracts selected components as tab-separated columns.
+ * Also serves as end-to-end throughput benchmark of the library (throughput is reported on stderr).
+ *
+ * Usage: rrlib_uri_process [-t <threads>] [-x <column>[,<column>...]] <input file>
+ *
+ * Columns: valid, scheme, authority, user_info, host, port, encoded_path, path, query, fragment, normalized
+ * Tabs, newlines, carriage returns and backslashes in columns are escaped as \t, \n, \r and \\ (e.g. in decoded paths).
+ * user_info, host and port are empty if the authority cannot be parsed.
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <iostream>
+#include <map>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/uri/tAuthority.h"
+#include "rrlib/uri/tURI.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::uri;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace
+{
+
+enum class tColumn
+{
+  VALID, SCHEME, AUTHORITY, USER_INFO, HOST, PORT, ENCODED_PATH, PATH, QUERY, FRAGMENT, NORMALIZED
+};
+
+/*! Selected columns - and which results need to be computed for them */
+struct tSelection
+{
+  std::vector<tColumn> columns;  //!< Selected columns (statistics are collected if empty)
+  bool validate, decode_path, parse_authority, normalize;
+
+  explicit tSelection(const std::vector<tColumn>& columns) :
+    columns(columns),
+    validate(Needs({ tColumn::VALID })),
+    decode_path(Needs({ tColumn::PATH })),
+    parse_authority(Needs({ tColumn::USER_INFO, tColumn::HOST, tColumn::PORT })),
+    normalize(Needs({ tColumn::NORMALIZED }))
+  {}
+
+private:
+
+  /*! \return Whether statistics are collected or any of the specified columns is selected */
+  bool Needs(std::initializer_list<tColumn> needed) const
+  {
+    return columns.empty() || std::find_first_of(columns.begin(), columns.end(), needed.begin(), needed.end()) != columns.end();
+  }
+};
+
+/*! Statistics on processed URIs (collected per chunk and merged) */
+struct tStatistics
+{
+  size_t uris = 0, invalid = 0, undecodable_paths = 0, not_normalized = 0;
+  size_t with_scheme = 0, with_authority = 0, with_user_info = 0, with_port = 0, with_query = 0, with_fragment = 0;
+  size_t path_elements = 0, max_path_elements = 0;
+  size_t host_types[4] = { 0, 0, 0, 0 };
+  std::unordered_map<std::string, size_t> schemes;
+
+  void Merge(const tStatistics& other)
+  {
+    uris += other.uris;
+    invalid += other.invalid;
+    undecodable_paths += other.undecodable_paths;
+    not_normalized += other.not_normalized;
+    with_scheme += other.with_scheme;
+    with_authority += other.with_authority;
+    with_user_info += other.with_user_info;
+    with_port += other.with_port;
+    with_query += other.with_query;
+    with_fragment += other.with_fragment;
+    path_elements += other.path_elements;
+    max_path_elements = std::max(max_path_elements, other.max_path_elements);
+    for (size_t i = 0; i < 4; i++)
+    {
+      host_types[i] += other.host_types[i];
+    }
+    for (auto & entry : other.schemes)
+    {
+      schemes[entry.first] += entry.second;
+    }
+  }
+};
+
+/*! Chunk of input file */
+struct tChunk
+{
+  const char* begin;
+  const char* end;
+  tStatistics statistics;
+  std::string output;
+  std::atomic<bool> done;
+
+  tChunk() : begin(nullptr), end(nullptr), done(false)
+  {}
+};
+
+/*! Scratch objects of one worker thread (reused for all URIs) */
+struct tScratch
+{
+  tPath path;
+  tURI uri;
+};
+
+}
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+static const size_t cCHUNK_SIZE = 4 * 1024 * 1024;
+static const char* cCOLUMN_NAMES[] = { "valid", "scheme", "authority", "user_info", "host", "port", "encoded_path", "path", "query", "fragment", "normalized" };
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * Appends string to output - escaping characters that would break the tab-separated format
+ */
+static void Append(std::string& output, const tStringRange& string)
+{
+  const char* current = string.CharPointer();
+  const char* end = current + string.Length();
+  while (current != end)
+  {
+    const char* escape = std::find_if(current, end, [](char c)
+    {
+      return c == '\t' || c == '\n' || c == '\r' || c == '\\';
+    });
+    output.append(current, escape);
+    if (escape == end)
+    {
+      break;
+    }
+    output.push_back('\\');
+    output.push_back((*escape) == '\t' ? 't' : ((*escape) == '\n' ? 'n' : ((*escape) == '\r' ? 'r' : '\\')));
+    current = escape + 1;
+  }
+}
+
+/*!
+ * Processes one URI
+ */
+static void Process(const tStringRange& uri_string, const tSelection& selection, tScratch& scratch, tStatistics& statistics, std::string& output)
+{
+  const std::vector<tColumn>& columns = selection.columns;
+  tURIView view(uri_string);
+  bool valid = selection.validate && tURI::Validate(uri_string);
+  bool path_decoded = true;
+  if (selection.decode_path)
+  {
+    try
+    {
+      tURI::DecodePath(view.path, scratch.path);
+    }
+    catch (const std::invalid_argument&)
+    {
+      path_decoded = false;
+      scratch.path.Clear();
+    }
+  }
+  tAuthority authority;
+  bool authority_valid = false;
+  if (selection.parse_authority)
+  {
+    try
+    {
+      authority.Set(view.authority);
+      authority_valid = true;
+    }
+    catch (const std::invalid_argument&)
+    {}
+  }
+  if (selection.normalize)
+  {
+    scratch.uri.Set(uri_string);
+  }
+
+  if (columns.empty())
+  {
+    statistics.uris++;
+    statistics.invalid += valid ? 0 : 1;
+    statistics.undecodable_paths += path_decoded ? 0 : 1;
+    statistics.not_normalized += scratch.uri.IsNormalized() ? 0 : 1;
+    if (view.HasScheme())
+    {
+      statistics.with_scheme++;
+      statistics.schemes[std::string(view.scheme.CharPointer(), view.scheme.Length())]++;
+    }
+    if (view.has_authority)
+    {
+      statistics.with_authority++;
+      if (authority_valid)
+      {
+        statistics.with_user_info += authority.HasUserInfo() ? 1 : 0;
+        statistics.with_port += authority.HasPort() ? 1 : 0;
+        statistics.host_types[static_cast<size_t>(authority.GetHostType())]++;
+      }
+    }
+    statistics.with_query += view.has_query ? 1 : 0;
+    statistics.with_fragment += view.has_fragment ? 1 : 0;
+    statistics.path_elements += scratch.path.Size();
+    statistics.max_path_elements = std::max(statistics.max_path_elements, scratch.path.Size());
+    return;
+  }
+
+  for (size_t i = 0; i < columns.size(); i++)
+  {
+    if (i > 0)
+    {
+      output.push_back('\t');
+    }
+    switch (columns[i])
+    {
+    case tColumn::VALID:
+      output.push_back(valid ? '1' : '0');
+      break;
+    case tColumn::SCHEME:
+      Append(output, view.scheme);
+      break;
+    case tColumn::AUTHORITY:
+      Append(output, view.authority);
+      break;
+    case tColumn::USER_INFO:
+      Append(output, authority_valid ? authority.GetUserInfo() : tStringRange());
+      break;
+    case tColumn::HOST:
+      Append(output, authority_valid ? authority.GetHost() : tStringRange());
+      break;
+    case tColumn::PORT:
+      Append(output, authority_valid ? authority.GetPortString() : tStringRange());
+      break;
+    case tColumn::ENCODED_PATH:
+      Append(output, view.path);
+      break;
+    case tColumn::PATH:
+      Append(output, scratch.path.ToStringRange());
+      break;
+    case tColumn::QUERY:
+      Append(output, view.query);
+      break;
+    case tColumn::FRAGMENT:
+      Append(output, view.fragment);
+      break;
+    case tColumn::NORMALIZED:
+      scratch.uri.Normalize();
+      output.append(scratch.uri.ToString());
+      break;
+    }
+  }
+  output.push_back('\n');
+}
+
+/*!
+ * Processes all URIs in chunk
+ */
+static void Process(tChunk& chunk, const tSelection& selection, tScratch& scratch)
+{
+  const char* line_begin = chunk.begin;
+  while (line_begin < chunk.end)
+  {
+    const char* line_end = static_cast<const char*>(memchr(line_begin, '\n', chunk.end - line_begin));
+    line_end = line_end ? line_end : chunk.end;
+    size_t length = line_end - line_begin;
+    length -= (length && line_begin[length - 1] == '\r') ? 1 : 0;
+    if (length)
+    {
+      Process(tStringRange(line_begin, length), selection, scratch, chunk.statistics, chunk.output);
+    }
+    line_begin = line_end + 1;
+  }
+  chunk.done = true;
+}
+
+static void PrintStatistics(const tStatistics& statistics)
+{
+  auto print = [&](const char* name, size_t count)
+  {
+    printf("%-24s %14zu %7.2f%%\n", name, count, statistics.uris ? 100.0 * count / statistics.uris : 0.0);
+  };
+  printf("%-24s %14zu\n", "URIs", statistics.uris);
+  print("Invalid (RFC 3986)", statistics.invalid);
+  print("Undecodable path", statistics.undecodable_paths);
+  print("Not normalized", statistics.not_normalized);
+  print("With scheme", statistics.with_scheme);
+  print("With authority", statistics.with_authority);
+  print("  with user info", statistics.with_user_info);
+  print("  with port", statistics.with_port);
+  print("  registered name", statistics.host_types[static_cast<size_t>(tAuthority::tHostType::REGISTERED_NAME)]);
+  print("  IPv4 address", statistics.host_types[static_cast<size_t>(tAuthority::tHostType::IPV4_ADDRESS)]);
+  print("  IPv6 address", statistics.host_types[static_cast<size_t>(tAuthority::tHostType::IPV6_ADDRESS)]);
+  print("  IPvFuture", statistics.host_types[static_cast<size_t>(tAuthority::tHostType::IP_FUTURE)]);
+  print("With query", statistics.with_query);
+  print("With fragment", statistics.with_fragment);
+  printf("%-24s %14.2f\n", "Path elements (mean)", statistics.uris ? static_cast<double>(statistics.path_elements) / statistics.uris : 0.0);
+  printf("%-24s %14zu\n", "Path elements (max)", statistics.max_path_elements);
+
+  std::multimap<size_t, std::string, std::greater<size_t>> schemes;
+  for (auto & entry : statistics.schemes)
+  {
+    schemes.emplace(entry.second, entry.first);
+  }
+  printf("\nSchemes:\n");
+  size_t printed = 0;
+  for (auto it = schemes.begin(); it != schemes.end() && printed < 20; ++it, ++printed)
+  {
+    print(("  " + it->second).c_str(), it->first);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  size_t thread_count = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<tColumn> columns;
+  const char* file_name = nullptr;
+  bool usage_error = false;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string argument = argv[i];
+    if (argument == "-t" && i + 1 < argc)
+    {
+      thread_count = std::max(1, atoi(argv[++i]));
+    }
+    else if (argument == "-x" && i + 1 < argc)
+    {
+      std::string list = argv[++i];
+      for (size_t begin = 0; begin <= list.length();)
+      {
+        size_t end = std::min(list.find(',', begin), list.length());
+        std::string name = list.substr(begin, end - begin);
+        auto column = std::find_if(std::begin(cCOLUMN_NAMES), std::end(cCOLUMN_NAMES), [&](const char * c)
+        {
+          return name == c;
+        });
+        if (column == std::end(cCOLUMN_NAMES))
+        {
+          std::cerr << "Unknown column '" << name << "'" << std::endl;
+          usage_error = true;
+          break;
+        }
+        columns.push_back(static_cast<tColumn>(column - std::begin(cCOLUMN_NAMES)));
+        begin = end + 1;
+      }
+    }
+    else if (file_name == nullptr && argument[0] != '-')
+    {
+      file_name = argv[i];
+    }
+    else
+    {
+      usage_error = true;
+    }
+  }
+  if (usage_error || file_name == nullptr)
+  {
+    std::cerr << "Usage: " << argv[0] << " [-t <threads>] [-x <column>[,<column>...]] <input file>" << std::endl;
+    std::cerr << "Columns: valid, scheme, authority, user_info, host, port, encoded_path, path, query, fragment, normalized" << std::endl;
+    return 1;
+  }
+
+  // Map input file
+  int file_descriptor = open(file_name, O_RDONLY);
+  struct stat file_status;
+  if (file_descriptor < 0 || fstat(file_descriptor, &file_status) != 0)
+  {
+    std::cerr << "Could not open '" << file_name << "': " << strerror(errno) << std::endl;
+    return 1;
+  }
+  size_t size = file_status.st_size;
+  const char* data = size ? static_cast<const char*>(mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0)) : nullptr;
+  close(file_descriptor);
+  if (data == MAP_FAILED)
+  {
+    std::cerr << "Could not map '" << file_name << "': " << strerror(errno) << std::endl;
+    return 1;
+  }
+  if (size)
+  {
+    madvise(const_cast<char*>(data), size, MADV_SEQUENTIAL);
+  }
+
+  // Split into chunks at line boundaries
+  std::vector<tChunk> chunks((size + cCHUNK_SIZE - 1) / cCHUNK_SIZE);
+  const char* chunk_begin = data;
+  size_t chunk_count = 0;
+  while (chunk_begin < data + size)
+  {
+    const char* chunk_end = std::min(chunk_begin + cCHUNK_SIZE, data + size);
+    const char* newline = chunk_end < data + size ? static_cast<const char*>(memchr(chunk_end, '\n', data + size - chunk_end)) : nullptr;
+    chunk_end = newline ? newline + 1 : data + size;
+    chunks[chunk_count].begin = chunk_begin;
+    chunks[chunk_count].end = chunk_end;
+    chunk_count++;
+    chunk_begin = chunk_end;
+  }
+
+  // Process chunks in parallel - writing extracted columns in input order
+  const tSelection selection(columns);
+  auto start = std::chrono::steady_clock::now();
+  std::atomic<size_t> next_chunk(0);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < std::min(thread_count, chunk_count); i++)
+  {
+    threads.emplace_back([&]()
+    {
+      tScratch scratch;
+      for (size_t chunk = next_chunk++; chunk < chunk_count; chunk = next_chunk++)
+      {
+        Process(chunks[chunk], selection, scratch);
+      }
+    });
+  }
+  tStatistics statistics;
+  for (size_t i = 0; i < chunk_count; i++)
+  {
+    while (!chunks[i].done)
+    {
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    fwrite(chunks[i].output.data(), 1, chunks[i].output.size(), stdout);
+    std::string().swap(chunks[i].output);
+    statistics.Merge(chunks[i].statistics);
+  }
+  for (auto & thread : threads)
+  {
+    thread.join();
+  }
+  std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+  if (columns.empty())
+  {
+    PrintStatistics(statistics);
+  }
+  fflush(stdout);
+  fprintf(stderr, "Processed %.1f MB with %zu threads in %.3f s (%.1f MB/s)\n", size / 1e6, std::min(thread_count, chunk_count), duration.count(), size / 1e6 / duration.count());
+  if (size)
+  {
+    munmap(const_cast<char*>(data), size);
+  }
+  return 0;
+}